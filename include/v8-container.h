@@ -97,6 +97,20 @@ class V8_EXPORT Array : public Object {
   Maybe<void> Iterate(Local<Context> context, IterationCallback callback,
                       void* callback_data);
 
+  /**
+   * Gets up to {values.size()} elements of this array, starting at {start},
+   * as if by calling Get() for each of them, and stores them to {values}.
+   * The values are created in the current HandleScope. Returns the number of
+   * elements stored, which is less than {values.size()} only if the array
+   * ends first.
+   *
+   * The elements of arrays with fast elements and without getters on the
+   * prototype chain are copied without a property lookup for each, and holes
+   * read as undefined.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<uint32_t> GetElements(
+      Local<Context> context, uint32_t start, MemorySpan<Local<Value>> values);
+
  private:
   Array();
   static void CheckCast(Value* obj);
@@ -152,11 +152,15 @@
  *   - bool
  *   - int32_t
  *   - uint32_t
+ *   - int64_t, uint64_t (as Numbers or BigInts, see Int64Representation)
  *   - float32_t
  *   - float64_t
+ *   - pointer to an embedder type
  * Currently supported argument types:
  *  - pointer to an embedder type
  *  - JavaScript array of primitive types
+ *  - TypedArray of any element type, as a const FastApiArrayBufferView&
+ *  - flat one-byte string, as a const FastOneByteString&
  *  - bool
  *  - int32_t
  *  - uint32_t
@@ -177,7 +181,7 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - TypedArrays and ArrayBuffers
+ *  - ArrayBuffers and DataViews
  *  - arrays of embedder types
  *
  *
@@ -378,6 +382,10 @@ struct V8_DEPRECATE_SOON(
 // own instance type. It could be supported if we specify that
 // TypedArray<T> always has precedence over the generic ArrayBufferView,
 // but this complicates overload resolution.
+// The view points directly into the backing store, without copying. Views
+// on detached, resizable or (unless kAllowSharedBit is set) shared buffers
+// take the slow path, so {data} and {byte_length} stay valid for the whole
+// call as long as the callback doesn't call back into JavaScript.
 struct FastApiArrayBufferView {
   void* data;
   size_t byte_length;
@@ -465,6 +473,7 @@ union V8_TRIVIAL_ABI AnyCType {
   Local<Object> object_value;
   Local<Array> sequence_value;
   const FastOneByteString* string_value;
+  const FastApiArrayBufferView* array_buffer_view_value;
   FastApiCallbackOptions* options_value;
 };
 
@@ -769,6 +778,16 @@ struct TypeInfoHelper<const FastOneByteString&> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastApiArrayBufferView&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() { return CTypeInfo::Type::kVoid; }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kIsTypedArray;
+  }
+};
+
 #define STATIC_ASSERT_IMPLIES(COND, ASSERTION, MSG) \
   static_assert(((COND) == 0) || (ASSERTION), MSG)
 
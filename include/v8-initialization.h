@@ -280,6 +280,12 @@ class V8_EXPORT V8 {
    */
   static void GetSharedMemoryStatistics(SharedMemoryStatistics* statistics);
 
+  /**
+   * Get statistics about the reuse of the memory of zone segments.
+   */
+  static void GetZoneSegmentPoolStatistics(
+      ZoneSegmentPoolStatistics* statistics);
+
  private:
   V8();
 
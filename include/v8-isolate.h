@@ -854,6 +854,15 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get contention statistics of the Atomics.Mutex and Atomics.Condition
+   * objects used by this isolate. May be called from any thread.
+   *
+   * \param statistics The AtomicsSynchronizationStatistics object to fill in.
+   */
+  void GetAtomicsSynchronizationStatistics(
+      AtomicsSynchronizationStatistics* statistics);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -101,6 +101,24 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+/**
+ * The old generation allocation limit that the predictive heap controller
+ * (--predictive-heap-controller) set after a full garbage collection, and the
+ * forecasts it was based on.
+ */
+struct GarbageCollectionLimitDecision {
+  int64_t live_bytes = -1;
+  int64_t predicted_live_bytes = -1;
+  int64_t allocation_limit_bytes = -1;
+  double allocation_rate_in_bytes_per_ms = -1.0;
+  double live_bytes_trend_in_bytes_per_ms = -1.0;
+  double gc_speed_in_bytes_per_ms = -1.0;
+  // What bounded the limit: 0 for the targeted GC CPU share, 1 for the minimum
+  // headroom, 2 for the maximum growing factor, 3 for the memory limit and 4
+  // for the heap's minimum or maximum old generation size.
+  int bound = -1;
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -209,6 +227,7 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionLimitDecision)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
@@ -8,6 +8,7 @@
 #include "v8-internal.h"           // NOLINT(build/include_directory)
 #include "v8-local-handle.h"       // NOLINT(build/include_directory)
 #include "v8-maybe.h"              // NOLINT(build/include_directory)
+#include "v8-memory-span.h"        // NOLINT(build/include_directory)
 #include "v8-persistent-handle.h"  // NOLINT(build/include_directory)
 #include "v8-primitive.h"          // NOLINT(build/include_directory)
 #include "v8-sandbox.h"            // NOLINT(build/include_directory)
@@ -303,6 +304,25 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the values of the properties {keys} of this object, as if by calling
+   * Get() for each of them, and stores them to the corresponding entries of
+   * {values}, which must be at least as long as {keys}. The values are
+   * created in the current HandleScope.
+   *
+   * This is typically faster than calling Get() repeatedly: own data
+   * properties of ordinary objects are read without a full property lookup,
+   * and the descriptor lookups are cached per map, which makes reading the
+   * same keys from many objects of the same shape cheap. Keys should be
+   * internalized strings or symbols to benefit from this.
+   *
+   * Returns Nothing if a getter or proxy trap throws, in which case the
+   * contents of {values} are unspecified.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> GetMultiple(
+      Local<Context> context, MemorySpan<const Local<Name>> keys,
+      MemorySpan<Local<Value>> values);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -315,6 +315,13 @@ class JobTask {
    * function, it must not call back any JobHandle methods.
    */
   virtual size_t GetMaxConcurrency(size_t worker_count) const = 0;
+
+  /**
+   * Returns the NUMA node whose memory the job mostly accesses, or -1 if the
+   * job has no preference. Platforms may use this as a hint to run the job on
+   * worker threads of that node.
+   */
+  virtual int GetNumaNodeHint() const { return -1; }
 };
 
 /**
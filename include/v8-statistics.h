@@ -131,6 +131,38 @@ class V8_EXPORT SharedMemoryStatistics {
   friend class internal::ReadOnlyHeap;
 };
 
+/**
+ * Statistics of the per-process pool of free zone segments, which V8 uses to
+ * recycle the memory of its temporary compiler data structures, accumulated
+ * since the process started.
+ *
+ * Instances of this class can be passed to
+ * v8::V8::GetZoneSegmentPoolStatistics.
+ */
+class V8_EXPORT ZoneSegmentPoolStatistics {
+ public:
+  ZoneSegmentPoolStatistics();
+  /** Segment allocations that reused the memory of a pooled segment. */
+  uint64_t hit_count() { return hit_count_; }
+  /** Hits on a segment cached by the allocating thread itself. */
+  uint64_t thread_cache_hit_count() { return thread_cache_hit_count_; }
+  /** Segment allocations that allocated fresh memory. */
+  uint64_t miss_count() { return miss_count_; }
+  /** Free segments that were released to the system. */
+  uint64_t release_count() { return release_count_; }
+  /** Memory currently held by the pool, not counting thread caches. */
+  size_t pooled_memory_size() { return pooled_memory_size_; }
+
+ private:
+  uint64_t hit_count_;
+  uint64_t thread_cache_hit_count_;
+  uint64_t miss_count_;
+  uint64_t release_count_;
+  size_t pooled_memory_size_;
+
+  friend class V8;
+};
+
 /**
  * Collection of V8 heap information.
  *
@@ -233,6 +265,40 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Contention statistics of the Atomics.Mutex and Atomics.Condition objects
+ * used by an isolate, accumulated since the isolate was created.
+ *
+ * Instances of this class can be passed to
+ * v8::Isolate::GetAtomicsSynchronizationStatistics.
+ */
+class V8_EXPORT AtomicsSynchronizationStatistics {
+ public:
+  AtomicsSynchronizationStatistics();
+  /** Lock attempts that found the mutex held by another thread. */
+  uint64_t contended_lock_count() { return contended_lock_count_; }
+  /** CPU pauses spent spinning on contended mutexes. */
+  uint64_t spin_count() { return spin_count_; }
+  /** Contended lock attempts that acquired the mutex while spinning. */
+  uint64_t spin_acquire_count() { return spin_acquire_count_; }
+  /** Times the thread went to sleep on a mutex or a condition. */
+  uint64_t park_count() { return park_count_; }
+  /** Total time spent sleeping on mutexes and conditions. */
+  uint64_t park_time_in_us() { return park_time_in_us_; }
+  /** Times a mutex was handed directly to a sleeping waiter on unlock. */
+  uint64_t handoff_count() { return handoff_count_; }
+
+ private:
+  uint64_t contended_lock_count_;
+  uint64_t spin_count_;
+  uint64_t spin_acquire_count_;
+  uint64_t park_count_;
+  uint64_t park_time_in_us_;
+  uint64_t handoff_count_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
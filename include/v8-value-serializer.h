@@ -128,6 +128,24 @@ class V8_EXPORT ValueSerializer {
     virtual bool AdoptSharedValueConveyor(Isolate* isolate,
                                           SharedValueConveyor&& conveyor);
 
+    /**
+     * Called when the ValueSerializer is going to write the contents of an
+     * ArrayBuffer that is neither shared nor resizable. The embedder can copy
+     * the |byte_length| bytes at |data| into storage of its own and return
+     * true with an ID for them in |contents_id|. In that case, only the ID is
+     * written to the buffer. When deserializing, this ID will be passed to
+     * ValueDeserializer::Delegate::GetArrayBufferFromContentsId.
+     *
+     * This allows embedders to avoid copying large ArrayBuffer and TypedArray
+     * payloads into (and out of) the serialized data.
+     *
+     * The default implementation returns false, which writes the contents to
+     * the buffer.
+     */
+    virtual bool WriteArrayBufferContents(Isolate* isolate, const void* data,
+                                          size_t byte_length,
+                                          uint32_t* contents_id);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -190,6 +208,18 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to write the property names of plain objects that share
+   * the same hidden class only once, as a shape that subsequent objects refer
+   * to. This makes the data smaller and faster to read for large graphs of
+   * similar objects, but the data cannot be read by versions of V8 that
+   * predate this option. It should therefore not be used for data that is
+   * persisted.
+   *
+   * The default is to write the property names for each object.
+   */
+  void SetUseObjectShapes(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -244,6 +274,15 @@ class V8_EXPORT ValueDeserializer {
      * ValueSerializer::Delegate::AdoptSharedValueConveyor.
      */
     virtual const SharedValueConveyor* GetSharedValueConveyor(Isolate* isolate);
+
+    /**
+     * Get an ArrayBuffer for the contents previously written out of band by
+     * ValueSerializer::Delegate::WriteArrayBufferContents under
+     * |contents_id|. The returned ArrayBuffer must be neither shared nor
+     * resizable.
+     */
+    virtual MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t contents_id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
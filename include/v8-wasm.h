@@ -53,6 +53,22 @@ class V8_EXPORT CompiledWasmModule {
    */
   MemorySpan<const uint8_t> GetWireBytesRef();
 
+  /**
+   * Get profile data describing the execution of this module so far: which
+   * functions were executed or tiered up, and the collected call-target
+   * feedback. The profile can be passed to {WasmStreaming::SetProfile} or
+   * {ApplyProfile} when compiling the same module again (with the same V8
+   * version), to optimize hot functions without waiting for them to warm up.
+   */
+  OwnedBuffer GetProfile();
+
+  /**
+   * Apply profile data previously returned by {GetProfile} for the same wire
+   * bytes. Functions that were hot in the profiled run get compiled in the
+   * background. Returns false if the profile data cannot be used.
+   */
+  bool ApplyProfile(MemorySpan<const uint8_t> profile);
+
   const std::string& source_url() const { return source_url_; }
 
  private:
@@ -174,6 +190,16 @@ class V8_EXPORT WasmStreaming final {
    */
   bool SetCompiledModuleBytes(const uint8_t* bytes, size_t size);
 
+  /**
+   * Passes profile data previously returned by
+   * {CompiledWasmModule::GetProfile}. Once the module is compiled, functions
+   * that were hot in the profiled run get compiled in the background. The
+   * data is copied, so the buffer does not need to outlive this call. Profile
+   * data that does not match the module is ignored. This must be called
+   * before {Finish}.
+   */
+  void SetProfile(const uint8_t* bytes, size_t size);
+
   /**
    * Sets a callback which is called whenever a significant number of new
    * functions are ready for serialization.
@@ -4,12 +4,15 @@
 
 #include "src/api/api-natives.h"
 
+#include <algorithm>
+
 #include "src/api/api-inl.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/logging/counters.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/lookup.h"
@@ -273,6 +276,35 @@ MaybeHandle<JSObject> ConfigureInstance(Isolate* isolate, Handle<JSObject> obj,
   return obj;
 }
 
+// Returns the number of fields that configuring an instance of {info} adds,
+// so that instances can be allocated with room for all of them in-object.
+int CountInstanceFields(Isolate* isolate, Tagged<ObjectTemplateInfo> info) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> maybe_property_list = info->property_list();
+  if (IsUndefined(maybe_property_list, isolate)) return 0;
+  Tagged<ArrayList> properties = Cast<ArrayList>(maybe_property_list);
+  int fields = 0;
+  int i = 0;
+  for (int c = 0; c < info->number_of_properties(); c++) {
+    i++;  // The name.
+    Tagged<Object> bit = properties->get(i++);
+    if (IsSmi(bit)) {
+      PropertyDetails details(Cast<Smi>(bit));
+      if (details.kind() == PropertyKind::kData) {
+        fields++;
+        i++;  // The value.
+      } else {
+        i += 2;  // The getter and setter.
+      }
+    } else {
+      // Intrinsic data property.
+      fields++;
+      i += 2;  // The details and the intrinsic.
+    }
+  }
+  return fields;
+}
+
 bool IsSimpleInstantiation(Isolate* isolate, Tagged<ObjectTemplateInfo> info,
                            Tagged<JSReceiver> new_target) {
   DisallowGarbageCollection no_gc;
@@ -307,9 +339,17 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
             isolate, isolate->native_context(), info->serial_number(),
             TemplateInfo::CachingMode::kLimited)
             .ToHandle(&result)) {
+      isolate->counters()->template_instantiation_cache_hits()->Increment();
       return isolate->factory()->CopyJSObject(result);
     }
   }
+  if (!is_prototype) {
+    if (should_cache) {
+      isolate->counters()->template_instantiation_cache_misses()->Increment();
+    } else {
+      isolate->counters()->template_instantiations_uncached()->Increment();
+    }
+  }
 
   if (constructor.is_null()) {
     Tagged<Object> maybe_constructor_info = info->constructor();
@@ -329,16 +369,31 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
     if (new_target.is_null()) new_target = constructor;
   }
 
-  const auto new_js_object_type =
-      constructor->has_initial_map() &&
-              IsJSApiWrapperObject(constructor->initial_map())
-          ? NewJSObjectType::kAPIWrapper
-          : NewJSObjectType::kNoAPIWrapper;
   Handle<JSObject> object;
-  ASSIGN_RETURN_ON_EXCEPTION(
-      isolate, object,
-      JSObject::New(constructor, new_target, Handle<AllocationSite>::null(),
-                    new_js_object_type));
+  if (!is_prototype && new_target.is_identical_to(constructor) &&
+      constructor.is_identical_to(isolate->object_function())) {
+    // Without a constructor template, allocate the instance like an object
+    // literal with the same number of properties, so that all of them fit
+    // in-object and copies of the cached instance take a single allocation.
+    int fields = CountInstanceFields(isolate, *info);
+    if (fields > constructor->initial_map()->GetInObjectProperties() &&
+        fields < JSObject::kMapCacheSize) {
+      object = isolate->factory()->NewJSObjectFromMap(
+          isolate->factory()->ObjectLiteralMapFromCache(
+              isolate->native_context(), fields));
+    }
+  }
+  if (object.is_null()) {
+    const auto new_js_object_type =
+        constructor->has_initial_map() &&
+                IsJSApiWrapperObject(constructor->initial_map())
+            ? NewJSObjectType::kAPIWrapper
+            : NewJSObjectType::kNoAPIWrapper;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, object,
+        JSObject::New(constructor, new_target, Handle<AllocationSite>::null(),
+                      new_js_object_type));
+  }
 
   if (is_prototype) JSObject::OptimizeAsPrototype(object);
 
@@ -629,11 +684,13 @@ Handle<JSFunction> ApiNatives::CreateApiFunction(
   }
 
   int embedder_field_count = 0;
+  int instance_field_count = 0;
   bool immutable_proto = false;
   if (!IsUndefined(obj->GetInstanceTemplate(), isolate)) {
     DirectHandle<ObjectTemplateInfo> GetInstanceTemplate(
         Cast<ObjectTemplateInfo>(obj->GetInstanceTemplate()), isolate);
     embedder_field_count = GetInstanceTemplate->embedder_field_count();
+    instance_field_count = CountInstanceFields(isolate, *GetInstanceTemplate);
     immutable_proto = GetInstanceTemplate->immutable_proto();
   }
 
@@ -642,8 +699,20 @@ Handle<JSFunction> ApiNatives::CreateApiFunction(
   int instance_size = JSObject::GetHeaderSize(type) +
                       kEmbedderDataSlotSize * embedder_field_count;
 
+  // Leave room in API objects for the fields that the instance template
+  // adds, so that instances don't need a separate property backing store.
+  int inobject_properties = 0;
+  if (InstanceTypeChecker::IsJSApiObject(type) &&
+      instance_size < JSObject::kMaxInstanceSize) {
+    inobject_properties =
+        std::min({instance_field_count, JSObject::kMaxInObjectProperties,
+                  (JSObject::kMaxInstanceSize - instance_size) / kTaggedSize});
+    instance_size += inobject_properties * kTaggedSize;
+  }
+
   Handle<Map> map = isolate->factory()->NewContextfulMap(
-      native_context, type, instance_size, TERMINAL_FAST_ELEMENTS_KIND);
+      native_context, type, instance_size, TERMINAL_FAST_ELEMENTS_KIND,
+      inobject_properties);
 
   // Mark as undetectable if needed.
   if (obj->undetectable()) {
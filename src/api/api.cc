@@ -83,14 +83,17 @@
 #include "src/objects/api-callbacks.h"
 #include "src/objects/backing-store.h"
 #include "src/objects/contexts.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type-inl.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-atomics-synchronization.h"
 #include "src/objects/js-collection-inl.h"
 #include "src/objects/js-objects.h"
 #include "src/objects/js-promise-inl.h"
@@ -136,10 +139,12 @@
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
 #include "src/utils/version.h"
+#include "src/zone/zone-segment-pool.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
@@ -3439,6 +3444,13 @@ bool ValueSerializer::Delegate::AdoptSharedValueConveyor(
   return false;
 }
 
+bool ValueSerializer::Delegate::WriteArrayBufferContents(Isolate* v8_isolate,
+                                                        const void* data,
+                                                        size_t byte_length,
+                                                        uint32_t* contents_id) {
+  return false;
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3472,6 +3484,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetUseObjectShapes(bool mode) {
+  private_->serializer.SetUseObjectShapes(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3546,6 +3562,16 @@ const SharedValueConveyor* ValueDeserializer::Delegate::GetSharedValueConveyor(
   return nullptr;
 }
 
+MaybeLocal<ArrayBuffer>
+ValueDeserializer::Delegate::GetArrayBufferFromContentsId(
+    Isolate* v8_isolate, uint32_t contents_id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<ArrayBuffer>();
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i_isolate, base::Vector<const uint8_t> data,
               Delegate* delegate)
@@ -4761,6 +4787,78 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+namespace {
+
+// Lets API functions that fill in several Locals create them in the
+// embedder's HandleScope, instead of escaping them one at a time.
+class V8_NODISCARD CallerHandleScope {
+ public:
+  explicit CallerHandleScope(i::Isolate*) {}
+};
+
+}  // namespace
+
+namespace internal {
+namespace {
+
+// Reads the own data property {name} of {receiver} without a LookupIterator,
+// if {receiver} is an ordinary object with fast properties. Returns false if
+// this doesn't find the property, which may still be an element, a property
+// on the prototype chain, or behind an accessor.
+bool TryFastGetOwnDataProperty(Isolate* isolate,
+                               DirectHandle<JSReceiver> receiver,
+                               Tagged<Name> name, Handle<Object>* result) {
+  if (!IsUniqueName(name)) return false;
+  Tagged<Map> map = receiver->map();
+  if (!IsJSObjectMap(map) || IsSpecialReceiverMap(map) ||
+      map->is_dictionary_map() || IsAlwaysSharedSpaceJSObject(*receiver)) {
+    return false;
+  }
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate);
+  InternalIndex entry = descriptors->SearchWithCache(isolate, name, map);
+  if (entry.is_not_found()) return false;
+  PropertyDetails details = descriptors->GetDetails(entry);
+  if (details.kind() != PropertyKind::kData) return false;
+  if (details.location() == PropertyLocation::kDescriptor) {
+    *result = handle(descriptors->GetStrongValue(entry), isolate);
+  } else {
+    *result = JSObject::FastPropertyAt(isolate, Cast<JSObject>(receiver),
+                                       details.representation(),
+                                       FieldIndex::ForDetails(map, details));
+  }
+  return true;
+}
+
+}  // namespace
+}  // namespace internal
+
+Maybe<void> v8::Object::GetMultiple(Local<Context> context,
+                                    MemorySpan<const Local<Name>> keys,
+                                    MemorySpan<Local<Value>> values) {
+  Utils::ApiCheck(values.size() >= keys.size(), "v8::Object::GetMultiple",
+                  "Fewer values than keys");
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i_isolate->clear_internal_exception();
+  ENTER_V8(i_isolate, context, Object, GetMultiple, CallerHandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    i::Handle<i::Object> result;
+    // The map is checked again for every key, as getters may change it.
+    if (!i::TryFastGetOwnDataProperty(i_isolate, self,
+                                      *Utils::OpenDirectHandle(*keys[i]),
+                                      &result)) {
+      i::HandleScope scope(i_isolate);
+      has_exception = !i::Runtime::GetObjectProperty(
+                           i_isolate, self, Utils::OpenHandle(*keys[i]))
+                           .ToHandle(&result);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+      result = scope.CloseAndEscape(result);
+    }
+    values[i] = Utils::ToLocal(result);
+  }
+  return JustVoid();
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, key.UnsafeAs<Value>());
@@ -6583,6 +6681,13 @@ SharedMemoryStatistics::SharedMemoryStatistics()
       read_only_space_used_size_(0),
       read_only_space_physical_size_(0) {}
 
+ZoneSegmentPoolStatistics::ZoneSegmentPoolStatistics()
+    : hit_count_(0),
+      thread_cache_hit_count_(0),
+      miss_count_(0),
+      release_count_(0),
+      pooled_memory_size_(0) {}
+
 HeapStatistics::HeapStatistics()
     : total_heap_size_(0),
       total_heap_size_executable_(0),
@@ -6616,6 +6721,14 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+AtomicsSynchronizationStatistics::AtomicsSynchronizationStatistics()
+    : contended_lock_count_(0),
+      spin_count_(0),
+      spin_acquire_count_(0),
+      park_count_(0),
+      park_time_in_us_(0),
+      handoff_count_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -6673,6 +6786,15 @@ void V8::GetSharedMemoryStatistics(SharedMemoryStatistics* statistics) {
   i::ReadOnlyHeap::PopulateReadOnlySpaceStatistics(statistics);
 }
 
+void V8::GetZoneSegmentPoolStatistics(ZoneSegmentPoolStatistics* statistics) {
+  i::ZoneSegmentPool* pool = i::ZoneSegmentPool::Get();
+  statistics->hit_count_ = pool->hit_count();
+  statistics->thread_cache_hit_count_ = pool->thread_cache_hit_count();
+  statistics->miss_count_ = pool->miss_count();
+  statistics->release_count_ = pool->release_count();
+  statistics->pooled_memory_size_ = pool->shared_size();
+}
+
 template <typename ObjectType>
 struct InvokeBootstrapper;
 
@@ -8398,6 +8520,77 @@ Maybe<void> v8::Array::Iterate(Local<Context> context,
   return JustVoid();
 }
 
+Maybe<uint32_t> v8::Array::GetElements(Local<Context> context, uint32_t start,
+                                       MemorySpan<Local<Value>> values) {
+  auto array = Utils::OpenHandle(this);
+  i::Isolate* i_isolate = array->GetIsolate();
+  ENTER_V8(i_isolate, context, Array, GetElements, CallerHandleScope);
+  uint32_t length = i::GetLength(*array);
+  uint32_t count =
+      start < length ? static_cast<uint32_t>(std::min<size_t>(
+                           length - start, values.size()))
+                     : 0;
+  if (count == 0) return Just(count);
+
+  if (i::CanUseFastIteration(i_isolate, array)) {
+    switch (array->GetElementsKind()) {
+      case i::PACKED_SMI_ELEMENTS:
+      case i::PACKED_ELEMENTS:
+      case i::PACKED_FROZEN_ELEMENTS:
+      case i::PACKED_SEALED_ELEMENTS:
+      case i::PACKED_NONEXTENSIBLE_ELEMENTS:
+      case i::HOLEY_SMI_ELEMENTS:
+      case i::HOLEY_FROZEN_ELEMENTS:
+      case i::HOLEY_SEALED_ELEMENTS:
+      case i::HOLEY_NONEXTENSIBLE_ELEMENTS:
+      case i::HOLEY_ELEMENTS: {
+        i::DisallowGarbageCollection no_gc;
+        i::Tagged<i::FixedArray> elements =
+            i::Cast<i::FixedArray>(array->elements());
+        i::Tagged<i::Object> undefined =
+            i::ReadOnlyRoots(i_isolate).undefined_value();
+        for (uint32_t i = 0; i < count; i++) {
+          i::Tagged<i::Object> element =
+              elements->get(static_cast<int>(start + i));
+          if (i::IsTheHole(element)) element = undefined;
+          values[i] = Utils::ToLocal(i::handle(element, i_isolate));
+        }
+        return Just(count);
+      }
+      case i::HOLEY_DOUBLE_ELEMENTS:
+      case i::PACKED_DOUBLE_ELEMENTS: {
+        // Allocating the numbers may move the elements.
+        i::DirectHandle<i::FixedDoubleArray> elements(
+            i::Cast<i::FixedDoubleArray>(array->elements()), i_isolate);
+        for (uint32_t i = 0; i < count; i++) {
+          i::Handle<i::Object> value;
+          if (elements->is_the_hole(start + i)) {
+            value = i_isolate->factory()->undefined_value();
+          } else {
+            double element = elements->get_scalar(start + i);
+            value = i_isolate->factory()->NewNumber(element);
+          }
+          values[i] = Utils::ToLocal(value);
+        }
+        return Just(count);
+      }
+      default:
+        break;
+    }
+  }
+
+  // Slow path: retrieving elements could have side effects.
+  for (uint32_t i = 0; i < count; i++) {
+    i::HandleScope scope(i_isolate);
+    i::Handle<i::Object> element;
+    has_exception = !i::JSReceiver::GetElement(i_isolate, array, start + i)
+                         .ToHandle(&element);
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(uint32_t);
+    values[i] = Utils::ToLocal(scope.CloseAndEscape(element));
+  }
+  return Just(count);
+}
+
 v8::TypecheckWitness::TypecheckWitness(Isolate* isolate)
 #ifdef V8_ENABLE_DIRECT_HANDLE
     // An empty local suffices.
@@ -8864,6 +9057,30 @@ MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer CompiledWasmModule::GetProfile() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.GetProfile");
+  base::OwnedVector<uint8_t> profile_data = i::wasm::GetProfileData(
+      native_module_->module(), native_module_->wire_bytes(),
+      native_module_->tiering_budget_array());
+  size_t size = profile_data.size();
+  return {profile_data.ReleaseData(), size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+bool CompiledWasmModule::ApplyProfile(MemorySpan<const uint8_t> profile) {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.ApplyProfile");
+  return i::wasm::ApplyProfileData(native_module_.get(),
+                                   base::VectorOf(profile.data(),
+                                                  profile.size()));
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #if V8_ENABLE_WEBASSEMBLY
   auto obj = Utils::OpenDirectHandle(this);
@@ -10232,6 +10449,23 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::GetAtomicsSynchronizationStatistics(
+    AtomicsSynchronizationStatistics* statistics) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::JSSynchronizationPrimitiveStatistics* stats =
+      i_isolate->atomics_synchronization_statistics();
+  statistics->contended_lock_count_ =
+      stats->contended_lock_count.load(std::memory_order_relaxed);
+  statistics->spin_count_ = stats->spin_count.load(std::memory_order_relaxed);
+  statistics->spin_acquire_count_ =
+      stats->spin_acquire_count.load(std::memory_order_relaxed);
+  statistics->park_count_ = stats->park_count.load(std::memory_order_relaxed);
+  statistics->park_time_in_us_ =
+      stats->park_time_in_us.load(std::memory_order_relaxed);
+  statistics->handoff_count_ =
+      stats->handoff_count.load(std::memory_order_relaxed);
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
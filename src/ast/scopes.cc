@@ -1700,26 +1700,28 @@ bool Scope::IsSkippableFunctionScope() {
          declaration_scope->preparse_data_builder() != nullptr;
 }
 
-void Scope::SavePreparseData(Parser* parser) {
-  this->ForEach([parser](Scope* scope) {
+void Scope::SavePreparseData(std::vector<uint8_t>* buffer, Zone* zone) {
+  this->ForEach([buffer, zone](Scope* scope) {
     // Save preparse data for every skippable scope, unless it was already
     // previously saved (this can happen with functions inside arrowheads).
     if (scope->IsSkippableFunctionScope() &&
         !scope->AsDeclarationScope()->was_lazily_parsed()) {
-      scope->AsDeclarationScope()->SavePreparseDataForDeclarationScope(parser);
+      scope->AsDeclarationScope()->SavePreparseDataForDeclarationScope(buffer,
+                                                                       zone);
     }
     return Iteration::kDescend;
   });
 }
 
-void DeclarationScope::SavePreparseDataForDeclarationScope(Parser* parser) {
+void DeclarationScope::SavePreparseDataForDeclarationScope(
+    std::vector<uint8_t>* buffer, Zone* zone) {
   if (preparse_data_builder_ == nullptr) return;
-  preparse_data_builder_->SaveScopeAllocationData(this, parser);
+  preparse_data_builder_->SaveScopeAllocationData(this, buffer, zone);
 }
 
-void DeclarationScope::AnalyzePartially(Parser* parser,
-                                        AstNodeFactory* ast_node_factory,
-                                        bool maybe_in_arrowhead) {
+void DeclarationScope::AnalyzePartially(
+    AstNodeFactory* ast_node_factory,
+    std::vector<uint8_t>* preparse_data_buffer, bool maybe_in_arrowhead) {
   DCHECK(!force_eager_compilation_);
   UnresolvedList new_unresolved_list;
 
@@ -1755,7 +1757,7 @@ void DeclarationScope::AnalyzePartially(Parser* parser,
       function_ = ast_node_factory->CopyVariable(function_);
     }
 
-    SavePreparseData(parser);
+    SavePreparseData(preparse_data_buffer, ast_node_factory->zone());
   }
 
 #ifdef DEBUG
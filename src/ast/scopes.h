@@ -6,6 +6,7 @@
 #define V8_AST_SCOPES_H_
 
 #include <numeric>
+#include <vector>
 
 #include "src/ast/ast.h"
 #include "src/base/compiler-specific.h"
@@ -686,7 +687,7 @@ class V8_EXPORT_PRIVATE Scope : public NON_EXPORTED_BASE(ZoneObject) {
 
   // Walk the scope chain to find DeclarationScopes; call
   // SavePreparseDataForDeclarationScope for each.
-  void SavePreparseData(Parser* parser);
+  void SavePreparseData(std::vector<uint8_t>* buffer, Zone* zone);
 
   // Create a non-local variable with a given name.
   // These variables are looked up dynamically at runtime.
@@ -1170,8 +1171,11 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   // discard the Scope contents for lazily compiled functions. In particular,
   // this records variables which cannot be resolved inside the Scope (we don't
   // yet know what they will resolve to since the outer Scopes are incomplete)
-  // and recreates them with the correct Zone with ast_node_factory.
-  void AnalyzePartially(Parser* parser, AstNodeFactory* ast_node_factory,
+  // and recreates them with the correct Zone with ast_node_factory. The
+  // preparse data is saved into the Zone of ast_node_factory, using
+  // preparse_data_buffer as scratch space.
+  void AnalyzePartially(AstNodeFactory* ast_node_factory,
+                        std::vector<uint8_t>* preparse_data_buffer,
                         bool maybe_in_arrowhead);
 
   // Allocate ScopeInfos for top scope and any inner scopes that need them.
@@ -1221,7 +1225,8 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   // Save data describing the context allocation of the variables in this scope
   // and its subscopes (except scopes at the laziness boundary). The data is
   // saved in produced_preparse_data_.
-  void SavePreparseDataForDeclarationScope(Parser* parser);
+  void SavePreparseDataForDeclarationScope(std::vector<uint8_t>* buffer,
+                                           Zone* zone);
 
   void set_preparse_data_builder(PreparseDataBuilder* preparse_data_builder) {
     preparse_data_builder_ = preparse_data_builder;
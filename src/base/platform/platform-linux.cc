@@ -8,6 +8,7 @@
 #include "src/base/platform/platform-linux.h"
 
 #include <pthread.h>
+#include <sched.h>
 #include <semaphore.h>
 #include <signal.h>
 #include <stdio.h>
@@ -30,10 +31,12 @@
 #include <sys/types.h>  // mmap & munmap
 #include <unistd.h>     // sysconf
 
+#include <climits>
 #include <cmath>
 #include <cstdio>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/base/memory.h"
@@ -76,6 +79,132 @@ void OS::SignalCodeMovingGC() {
 
 void OS::AdjustSchedulingParams() {}
 
+namespace {
+
+// Calls {callback} for each number in the list of ranges like "0-3,8,10-11"
+// in the first line of the file at {path}.
+template <typename Callback>
+bool ForEachInRangeList(const char* path, Callback callback) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return false;
+  char buffer[4096];
+  bool success = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!success) return false;
+  const char* current = buffer;
+  while (*current != '\0' && *current != '\n') {
+    char* end;
+    long first = strtol(current, &end, 10);  // NOLINT(runtime/int)
+    if (end == current) return false;
+    long last = first;  // NOLINT(runtime/int)
+    if (*end == '-') {
+      current = end + 1;
+      last = strtol(current, &end, 10);
+      if (end == current) return false;
+    }
+    for (long i = first; i <= last; ++i) {  // NOLINT(runtime/int)
+      callback(static_cast<int>(i));
+    }
+    current = *end == ',' ? end + 1 : end;
+  }
+  return true;
+}
+
+// The NUMA nodes of the system as described in sysfs.
+class NumaTopology {
+ public:
+  // The node masks passed to mbind are single words.
+  static constexpr int kMaxNodeCount = sizeof(unsigned long) * CHAR_BIT;
+
+  NumaTopology() {
+    int max_node = 0;
+    if (!ForEachInRangeList("/sys/devices/system/node/online",
+                            [&](int node) {
+                              max_node = std::max(max_node, node);
+                            }) ||
+        max_node == 0 || max_node >= kMaxNodeCount) {
+      return;
+    }
+    node_cpus_.resize(max_node + 1);
+    for (int node = 0; node <= max_node; ++node) {
+      cpu_set_t* cpus = &node_cpus_[node];
+      CPU_ZERO(cpus);
+      char path[64];
+      OS::SNPrintF(path, sizeof(path),
+                   "/sys/devices/system/node/node%d/cpulist", node);
+      ForEachInRangeList(path, [cpus](int cpu) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, cpus);
+      });
+    }
+  }
+
+  // Systems with a single node, or whose nodes couldn't be determined, are
+  // treated as not supporting NUMA.
+  bool is_numa() const { return !node_cpus_.empty(); }
+  int node_count() const {
+    return is_numa() ? static_cast<int>(node_cpus_.size()) : 1;
+  }
+  const cpu_set_t* node_cpus(int node) const { return &node_cpus_[node]; }
+
+ private:
+  std::vector<cpu_set_t> node_cpus_;
+};
+
+const NumaTopology& GetNumaTopology() {
+  static const NumaTopology topology;
+  return topology;
+}
+
+}  // namespace
+
+int OS::GetNumaNodeCount() { return GetNumaTopology().node_count(); }
+
+int OS::GetCurrentNumaNode() {
+  if (!GetNumaTopology().is_numa()) return 0;
+  unsigned cpu;
+  unsigned node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return 0;
+  return static_cast<int>(node);
+}
+
+bool OS::SetNumaNodeForMemory(void* address, size_t size, int node) {
+  const NumaTopology& topology = GetNumaTopology();
+  if (!topology.is_numa() || node < 0 || node >= topology.node_count()) {
+    return false;
+  }
+  // From <linux/mempolicy.h>.
+  constexpr int kMpolPreferred = 1;
+  unsigned long node_mask = 1ul << node;  // NOLINT(runtime/int)
+  // The kernel ignores the last bit of the mask.
+  constexpr unsigned long kMaxNode =  // NOLINT(runtime/int)
+      NumaTopology::kMaxNodeCount + 1;
+  return syscall(SYS_mbind, address, size, kMpolPreferred, &node_mask,
+                 kMaxNode, 0) == 0;
+}
+
+struct CurrentThreadNumaNodeScope::SavedCpus {
+  cpu_set_t cpus;
+};
+
+CurrentThreadNumaNodeScope::CurrentThreadNumaNodeScope(int node) {
+  const NumaTopology& topology = GetNumaTopology();
+  if (!topology.is_numa() || node < 0 || node >= topology.node_count()) {
+    return;
+  }
+  auto saved_cpus = std::make_unique<SavedCpus>();
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &saved_cpus->cpus) != 0 ||
+      sched_setaffinity(0, sizeof(cpu_set_t), topology.node_cpus(node)) != 0) {
+    return;
+  }
+  saved_cpus_ = std::move(saved_cpus);
+}
+
+CurrentThreadNumaNodeScope::~CurrentThreadNumaNodeScope() {
+  if (saved_cpus_) {
+    sched_setaffinity(0, sizeof(cpu_set_t), &saved_cpus_->cpus);
+  }
+}
+
 void* OS::RemapShared(void* old_address, void* new_address, size_t size) {
   void* result =
       mremap(old_address, 0, size, MREMAP_FIXED | MREMAP_MAYMOVE, new_address);
@@ -29,5 +29,26 @@ Stack::StackSlot Stack::GetStackStart() {
   return GetStackStartUnchecked();
 }
 
+#if !V8_OS_LINUX
+// NUMA is only supported on Linux, see platform-linux.cc.
+
+// static
+int OS::GetNumaNodeCount() { return 1; }
+
+// static
+int OS::GetCurrentNumaNode() { return 0; }
+
+// static
+bool OS::SetNumaNodeForMemory(void* address, size_t size, int node) {
+  return false;
+}
+
+struct CurrentThreadNumaNodeScope::SavedCpus {};
+
+CurrentThreadNumaNodeScope::CurrentThreadNumaNodeScope(int node) {}
+
+CurrentThreadNumaNodeScope::~CurrentThreadNumaNodeScope() = default;
+#endif  // !V8_OS_LINUX
+
 }  // namespace base
 }  // namespace v8
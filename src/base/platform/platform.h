@@ -23,6 +23,7 @@
 
 #include <cstdarg>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -313,6 +314,18 @@ class V8_BASE_EXPORT OS {
 
   static void AdjustSchedulingParams();
 
+  // NUMA support. Nodes are numbered from 0 to GetNumaNodeCount() - 1; on
+  // systems without NUMA support, or where V8 doesn't support it, there is
+  // a single node.
+  static constexpr int kAnyNumaNode = -1;
+  static int GetNumaNodeCount();
+  // Returns the node of the CPU that the calling thread is running on.
+  static int GetCurrentNumaNode();
+  // Makes the pages of [address, address + size) that are not faulted in yet
+  // prefer physical memory of {node}. Returns false if that's not supported.
+  static bool SetNumaNodeForMemory(void* address, size_t size, int node);
+  // See CurrentThreadNumaNodeScope for restricting threads to a node.
+
   using Address = uintptr_t;
 
   struct MemoryRange {
@@ -439,6 +452,30 @@ inline void EnsureConsoleOutput() {
 #endif  // defined(V8_OS_WIN)
 }
 
+// ----------------------------------------------------------------------------
+// CurrentThreadNumaNodeScope
+//
+// Restricts the calling thread to the CPUs of a NUMA node while the scope is
+// alive, and then restores the CPUs that the thread was allowed to run on
+// before, whoever set them. Does nothing if NUMA isn't supported or the node
+// doesn't exist.
+class V8_BASE_EXPORT CurrentThreadNumaNodeScope final {
+ public:
+  explicit CurrentThreadNumaNodeScope(int node);
+  ~CurrentThreadNumaNodeScope();
+
+  CurrentThreadNumaNodeScope(const CurrentThreadNumaNodeScope&) = delete;
+  CurrentThreadNumaNodeScope& operator=(const CurrentThreadNumaNodeScope&) =
+      delete;
+
+  // Whether the thread was restricted to the node.
+  bool is_active() const { return saved_cpus_ != nullptr; }
+
+ private:
+  struct SavedCpus;
+  std::unique_ptr<SavedCpus> saved_cpus_;
+};
+
 // ----------------------------------------------------------------------------
 // AddressSpaceReservation
 //
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -14,6 +15,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/counters.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -51,14 +53,13 @@ class BaselineCompilerTask {
         local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
   }
 
-  // Executed in the main thread.
-  void Install(Isolate* isolate) {
+  // Executed in the main thread. Installs the code on the
+  // SharedFunctionInfo without allocating, so that all of the tasks of a batch
+  // can be installed in a single step without reaching a safepoint.
+  void Publish(Isolate* isolate) {
     shared_function_info_->set_is_sparkplug_compiling(false);
     Handle<Code> code;
     if (!maybe_code_.ToHandle(&code)) return;
-    if (v8_flags.print_code) {
-      Print(*code);
-    }
     // Don't install the code if the bytecode has been flushed or has
     // already some baseline code installed.
     if (!CanCompileWithConcurrentBaseline(*shared_function_info_, isolate)) {
@@ -67,6 +68,17 @@ class BaselineCompilerTask {
 
     shared_function_info_->set_baseline_code(*code, kReleaseStore);
     shared_function_info_->set_age(0);
+    installed_ = true;
+  }
+
+  // Executed in the main thread, after Publish.
+  void Log(Isolate* isolate) {
+    Handle<Code> code;
+    if (!maybe_code_.ToHandle(&code)) return;
+    if (v8_flags.print_code) {
+      Print(*code);
+    }
+    if (!installed_) return;
     if (v8_flags.trace_baseline) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       std::stringstream ss;
@@ -91,13 +103,15 @@ class BaselineCompilerTask {
   Handle<BytecodeArray> bytecode_;
   MaybeHandle<Code> maybe_code_;
   base::TimeDelta time_taken_;
+  bool installed_ = false;
 };
 
 class BaselineBatchCompilerJob {
  public:
   BaselineBatchCompilerJob(Isolate* isolate,
                            DirectHandle<WeakFixedArray> task_queue,
-                           int batch_size) {
+                           int batch_size)
+      : enqueue_time_(base::TimeTicks::Now()) {
     handles_ = isolate->NewPersistentHandles();
     tasks_.reserve(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -112,8 +126,15 @@ class BaselineBatchCompilerJob {
       if (!CanCompileWithConcurrentBaseline(shared, isolate)) continue;
       // Skip functions that are already being compiled.
       if (shared->is_sparkplug_compiling()) continue;
+      {
+        DisallowHeapAllocation no_gc;
+        estimated_size_ += BaselineCompiler::EstimateInstructionSize(
+            shared->GetBytecodeArray(isolate));
+      }
       tasks_.emplace_back(isolate, handles_.get(), shared);
     }
+    isolate->counters()->baseline_batch_size()->AddSample(
+        static_cast<int>(tasks_.size()));
     if (v8_flags.trace_baseline) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       PrintF(scope.file(), "[Concurrent Sparkplug] compiling %zu functions\n",
@@ -123,25 +144,47 @@ class BaselineBatchCompilerJob {
 
   // Executed in the background thread.
   void Compile(LocalIsolate* local_isolate) {
+    base::ElapsedTimer timer;
+    timer.Start();
     local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
     for (auto& task : tasks_) {
       task.Compile(local_isolate);
     }
     // Get the handle back since we'd need them to install the code later.
     handles_ = local_isolate->heap()->DetachPersistentHandles();
+    compile_time_ = timer.Elapsed();
+    compile_end_time_ = base::TimeTicks::Now();
   }
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
     HandleScope local_scope(isolate);
+    {
+      // The code of the whole batch is published at once, without any
+      // allocation (and thus safepoint) in between.
+      DisallowGarbageCollection no_gc;
+      for (auto& task : tasks_) {
+        task.Publish(isolate);
+      }
+    }
     for (auto& task : tasks_) {
-      task.Install(isolate);
+      task.Log(isolate);
     }
   }
 
+  int estimated_size() const { return estimated_size_; }
+  base::TimeTicks enqueue_time() const { return enqueue_time_; }
+  base::TimeTicks compile_end_time() const { return compile_end_time_; }
+  base::TimeDelta compile_time() const { return compile_time_; }
+
  private:
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  // Sum of the estimated instruction size of {tasks_}.
+  int estimated_size_ = 0;
+  base::TimeTicks enqueue_time_;
+  base::TimeTicks compile_end_time_;
+  base::TimeDelta compile_time_;
 };
 
 class ConcurrentBaselineCompiler {
@@ -214,11 +257,22 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
-  void InstallBatch() {
+  void InstallBatch(BaselineBatchCompiler* batch_compiler) {
     while (!outgoing_queue_.IsEmpty()) {
       std::unique_ptr<BaselineBatchCompilerJob> job;
       outgoing_queue_.Dequeue(&job);
+      base::TimeTicks install_start = base::TimeTicks::Now();
       job->Install(isolate_);
+      base::TimeTicks install_end = base::TimeTicks::Now();
+
+      Counters* counters = isolate_->counters();
+      counters->baseline_batch_install_time()->AddTimedSample(install_end -
+                                                              install_start);
+      counters->baseline_batch_latency()->AddTimedSample(install_end -
+                                                         job->enqueue_time());
+      batch_compiler->RecordInstalledBatch(
+          job->estimated_size(), job->compile_time(),
+          install_start - job->compile_end_time());
     }
   }
 
@@ -229,6 +283,50 @@ class ConcurrentBaselineCompiler {
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> outgoing_queue_;
 };
 
+AdaptiveBatchSizer::AdaptiveBatchSizer()
+    : threshold_(std::clamp(
+          v8_flags.baseline_batch_compilation_threshold.value(),
+          v8_flags.baseline_batch_compilation_min_threshold.value(),
+          std::max(v8_flags.baseline_batch_compilation_min_threshold.value(),
+                   v8_flags.baseline_batch_compilation_max_threshold.value()))) {
+}
+
+void AdaptiveBatchSizer::RecordBatch(int estimated_size,
+                                     base::TimeDelta compile_time,
+                                     base::TimeDelta install_delay) {
+  // Batches whose functions all got flushed or were already compiled don't
+  // tell us anything about the throughput.
+  if (estimated_size == 0) return;
+  double compile_ms = std::max(compile_time.InMillisecondsF(), 0.001);
+  double throughput = estimated_size / compile_ms;
+  double install_delay_ms = std::max(install_delay.InMillisecondsF(), 0.0);
+  if (throughput_ == 0) {
+    throughput_ = throughput;
+    install_delay_ms_ = install_delay_ms;
+  } else {
+    throughput_ = kSmoothingFactor * throughput +
+                  (1 - kSmoothingFactor) * throughput_;
+    install_delay_ms_ = kSmoothingFactor * install_delay_ms +
+                        (1 - kSmoothingFactor) * install_delay_ms_;
+  }
+
+  double target_ms = v8_flags.baseline_batch_compilation_target_ms;
+  double threshold = throughput_ * target_ms;
+  // A main thread that is slow to install batches is busy rather than idle:
+  // interrupt it less often by compiling larger batches.
+  static constexpr double kMaxBusyScaling = 4.0;
+  if (install_delay_ms_ > target_ms) {
+    threshold *= std::min(install_delay_ms_ / target_ms, kMaxBusyScaling);
+  }
+
+  double min = static_cast<double>(
+      v8_flags.baseline_batch_compilation_min_threshold.value());
+  double max = std::max(
+      min, static_cast<double>(
+               v8_flags.baseline_batch_compilation_max_threshold.value()));
+  threshold_ = static_cast<int>(std::clamp(threshold, min, max));
+}
+
 BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
     : isolate_(isolate),
       compilation_queue_(Handle<WeakFixedArray>::null()),
@@ -290,7 +388,30 @@ void BaselineBatchCompiler::Enqueue(DirectHandle<SharedFunctionInfo> shared) {
 
 void BaselineBatchCompiler::InstallBatch() {
   DCHECK(v8_flags.concurrent_sparkplug);
-  concurrent_compiler_->InstallBatch();
+  concurrent_compiler_->InstallBatch(this);
+}
+
+int BaselineBatchCompiler::batch_threshold() const {
+  if (v8_flags.baseline_batch_compilation_adaptive && concurrent()) {
+    return adaptive_sizer_.threshold();
+  }
+  return v8_flags.baseline_batch_compilation_threshold;
+}
+
+void BaselineBatchCompiler::RecordInstalledBatch(
+    int estimated_size, base::TimeDelta compile_time,
+    base::TimeDelta install_delay) {
+  if (!v8_flags.baseline_batch_compilation_adaptive) return;
+  adaptive_sizer_.RecordBatch(estimated_size, compile_time, install_delay);
+  if (v8_flags.trace_baseline_batch_compilation) {
+    CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+    PrintF(trace_scope.file(),
+           "[Baseline batch compilation] Installed batch of size %d "
+           "(compiled in %.3f ms, installed after %.3f ms), new threshold: "
+           "%d\n",
+           estimated_size, compile_time.InMillisecondsF(),
+           install_delay.InMillisecondsF(), adaptive_sizer_.threshold());
+  }
 }
 
 void BaselineBatchCompiler::EnsureQueueCapacity() {
@@ -353,11 +474,9 @@ bool BaselineBatchCompiler::ShouldCompileBatch(
            shared->DebugNameCStr().get());
     PrintF(trace_scope.file(),
            " with estimated size %d (current budget: %d/%d)\n", estimated_size,
-           estimated_instruction_size_,
-           v8_flags.baseline_batch_compilation_threshold.value());
+           estimated_instruction_size_, batch_threshold());
   }
-  if (estimated_instruction_size_ >=
-      v8_flags.baseline_batch_compilation_threshold) {
+  if (estimated_instruction_size_ >= batch_threshold()) {
     if (v8_flags.trace_baseline_batch_compilation) {
       CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
       PrintF(trace_scope.file(),
@@ -7,6 +7,7 @@
 
 #include <atomic>
 
+#include "src/base/platform/time.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/handles.h"
 
@@ -17,6 +18,35 @@ namespace baseline {
 class BaselineCompiler;
 class ConcurrentBaselineCompiler;
 
+// Computes the batch threshold used with --baseline-batch-compilation-adaptive.
+// Batches are sized so that compiling one takes about
+// --baseline-batch-compilation-target-ms on a background thread, based on the
+// smoothed compile throughput of previous batches. When the main thread is slow
+// to install compiled batches (i.e. it is busy rather than idle), batches are
+// made larger so that it gets interrupted less often.
+class V8_EXPORT_PRIVATE AdaptiveBatchSizer {
+ public:
+  AdaptiveBatchSizer();
+
+  // Records a batch of {estimated_size} bytes of instructions which took
+  // {compile_time} to compile in the background and then waited
+  // {install_delay} for the main thread to install it.
+  void RecordBatch(int estimated_size, base::TimeDelta compile_time,
+                   base::TimeDelta install_delay);
+
+  int threshold() const { return threshold_; }
+
+ private:
+  // Weight of the latest batch in the smoothed averages.
+  static constexpr double kSmoothingFactor = 0.3;
+
+  // Smoothed compile throughput, in estimated instruction bytes per ms.
+  double throughput_ = 0;
+  // Smoothed delay between the end of a background compile and its install.
+  double install_delay_ms_ = 0;
+  int threshold_;
+};
+
 class BaselineBatchCompiler {
  public:
   static const int kInitialQueueSize = 32;
@@ -32,6 +62,13 @@ class BaselineBatchCompiler {
 
   void InstallBatch();
 
+  // The estimated instruction size above which the current batch is compiled.
+  int batch_threshold() const;
+
+  // Called on the main thread when a concurrently compiled batch got installed.
+  void RecordInstalledBatch(int estimated_size, base::TimeDelta compile_time,
+                            base::TimeDelta install_delay);
+
  private:
   bool concurrent() const;
 
@@ -77,6 +114,8 @@ class BaselineBatchCompiler {
 
   // Handle to the background compilation jobs.
   std::unique_ptr<ConcurrentBaselineCompiler> concurrent_compiler_;
+
+  AdaptiveBatchSizer adaptive_sizer_;
 };
 
 }  // namespace baseline
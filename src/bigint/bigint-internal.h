@@ -5,7 +5,9 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "src/bigint/bigint.h"
 
@@ -24,6 +26,12 @@ constexpr int kNewtonInversionThreshold = 50;
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
 
+// Minimum input sizes (in digits) for splitting work across threads; below
+// these, the synchronization overhead outweighs the gains.
+constexpr int kFftParallelThreshold = 20000;
+constexpr int kToStringParallelThreshold = 10000;
+constexpr int kFromStringParallelThreshold = 10000;
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -75,6 +83,14 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  int max_parallelism() { return platform_->MaxParallelism(); }
+
+  // Calls {task(processor, i)} for each i in [0, count), in parallel if the
+  // platform supports it. Processors are not thread-safe, so each invocation
+  // gets its own.
+  template <typename Task>
+  void ParallelFor(int count, const Task& task);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -98,6 +114,56 @@ class ProcessorImpl : public Processor {
   Platform* platform_;
 };
 
+// The platform of processors running a part of a parallel operation. Interrupt
+// requests are only checked on the thread that started the operation (since
+// the embedder's platform might not support checking them on other threads),
+// and forwarded to the other parts.
+class ParallelTaskPlatform final : public Platform {
+ public:
+  ParallelTaskPlatform(Platform* parent, std::thread::id parent_thread,
+                       std::atomic<bool>* interrupted)
+      : parent_(parent),
+        parent_thread_(parent_thread),
+        interrupted_(interrupted) {}
+
+  bool InterruptRequested() override {
+    if (std::this_thread::get_id() == parent_thread_ &&
+        parent_->InterruptRequested()) {
+      interrupted_->store(true, std::memory_order_relaxed);
+    }
+    return interrupted_->load(std::memory_order_relaxed);
+  }
+
+  int MaxParallelism() override { return parent_->MaxParallelism(); }
+  void RunInParallel(int count, const std::function<void(int)>& task) override {
+    parent_->RunInParallel(count, task);
+  }
+
+ private:
+  Platform* parent_;
+  std::thread::id parent_thread_;
+  std::atomic<bool>* interrupted_;
+};
+
+template <typename Task>
+void ProcessorImpl::ParallelFor(int count, const Task& task) {
+  if (count <= 1 || platform_->MaxParallelism() <= 1) {
+    for (int i = 0; i < count && !should_terminate(); i++) task(this, i);
+    return;
+  }
+  std::atomic<bool> interrupted{false};
+  std::thread::id thread = std::this_thread::get_id();
+  platform_->RunInParallel(count, [&](int i) {
+    if (interrupted.load(std::memory_order_relaxed)) return;
+    ProcessorImpl processor(
+        new ParallelTaskPlatform(platform_, thread, &interrupted));
+    task(&processor, i);
+  });
+  if (interrupted.load(std::memory_order_relaxed)) {
+    status_ = Status::kInterrupted;
+  }
+}
+
 // These constants are primarily needed for Barrett division in div-barrett.cc,
 // and they're also needed by fast to-string conversion in tostring.cc.
 constexpr int DivideBarrettScratchSpace(int n) { return n + 2; }
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <iostream>
 #include <vector>
 
@@ -201,6 +202,18 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // If you want operations on huge inputs to be split across multiple
+  // threads, implement a Platform subclass that overrides these methods.
+  // {MaxParallelism} returns the number of tasks that can usefully run at the
+  // same time, including on the calling thread. {RunInParallel} must call
+  // {task(i)} exactly once for each i in [0, count), possibly concurrently, and
+  // may only return once all of them have finished. Both are called on
+  // whichever thread is running the operation.
+  virtual int MaxParallelism() { return 1; }
+  virtual void RunInParallel(int count, const std::function<void(int)>& task) {
+    for (int i = 0; i < count; i++) task(i);
+  }
 };
 
 // These are the operations that this library supports.
@@ -147,21 +147,44 @@ void ProcessorImpl::FromStringLarge(RWDigits Z,
     RWDigits new_parts = temp;
     RWDigits new_multipliers = parts;
     int new_part_len = part_len * 2;
+    int num_pairs = num_parts / 2;
+    // p[j] = p[i] * m[i+1] + p[i+1]
+    // These are independent of each other, so when they are big enough, they
+    // are computed in parallel. Since {new_multipliers} uses the same storage
+    // as {parts}, this must happen before computing the new multipliers.
+    auto multiply_parts = [&](ProcessorImpl* processor, int first_pair,
+                              int end_pair) {
+      for (int pair = first_pair; pair < end_pair; pair++) {
+        int start = 2 * pair * part_len;
+        Digits p_in(parts, start, part_len);
+        Digits p_in2(parts, start + part_len, part_len);
+        Digits m_in2(multipliers, start + part_len, part_len);
+        RWDigits p_out(new_parts, start, new_part_len);
+        processor->Multiply(p_out, p_in, m_in2);
+        if (processor->should_terminate()) return;
+        digit_t overflow = AddAndReturnOverflow(p_out, p_in2);
+        DCHECK(overflow == 0);
+        USE(overflow);
+      }
+    };
+    int tasks = std::min(max_parallelism(), num_pairs);
+    if (tasks > 1 && num_parts * part_len >= kFromStringParallelThreshold) {
+      int pairs_per_task = (num_pairs + tasks - 1) / tasks;
+      ParallelFor(tasks, [&](ProcessorImpl* processor, int task) {
+        int first_pair = task * pairs_per_task;
+        multiply_parts(processor, first_pair,
+                       std::min(first_pair + pairs_per_task, num_pairs));
+      });
+    } else {
+      multiply_parts(this, 0, num_pairs);
+    }
+    if (should_terminate()) return;
     int i = 0;
     for (; i + 1 < num_parts; i += 2) {
       int start = i * part_len;
-      Digits p_in(parts, start, part_len);
-      Digits p_in2(parts, start + part_len, part_len);
       Digits m_in(multipliers, start, part_len);
       Digits m_in2(multipliers, start + part_len, part_len);
-      RWDigits p_out(new_parts, start, new_part_len);
       RWDigits m_out(new_multipliers, start, new_part_len);
-      // p[j] = p[i] * m[i+1] + p[i+1]
-      Multiply(p_out, p_in, m_in2);
-      if (should_terminate()) return;
-      digit_t overflow = AddAndReturnOverflow(p_out, p_in2);
-      DCHECK(overflow == 0);
-      USE(overflow);
       // m[j] = m[i] * m[i+1]
       if (i > 0) {
         bool copied = false;
@@ -460,10 +460,13 @@ class FFTContainer {
 
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
+  void BackwardFFT_Combine(int start, int len, int omega, digit_t* temp);
+  void BackwardFFT_Parallel(int omega);
 
   void PointwiseMultiply(const FFTContainer& other);
+  void PointwiseMultiply_Parallel(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -599,6 +602,14 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
     BackwardFFT_Threadsafe(start, half, 2 * omega, temp);
     BackwardFFT_Threadsafe(start + half, half, 2 * omega, temp);
   }
+  BackwardFFT_Combine(start, len, omega, temp);
+}
+
+// The last step of {BackwardFFT_Threadsafe}, after both halves have been
+// transformed.
+void FFTContainer::BackwardFFT_Combine(int start, int len, int omega,
+                                       digit_t* temp) {
+  int half = len / 2;
   SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
           length_);
   for (int k = 1; k < half; k++) {
@@ -609,6 +620,19 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
   }
 }
 
+// Same as {BackwardFFT}, but transforms the two halves in parallel.
+void FFTContainer::BackwardFFT_Parallel(int omega) {
+  int half = n_ / 2;
+  if (half <= 2) return BackwardFFT(0, n_, omega);
+  processor_->ParallelFor(2, [&](ProcessorImpl*, int i) {
+    // The half that runs on the calling thread could use {temp_}, but we
+    // don't know which one that is.
+    ScratchDigits temp(2 * length_);
+    BackwardFFT_Threadsafe(i * half, half, 2 * omega, temp.digits());
+  });
+  BackwardFFT_Combine(0, n_, omega, temp_);
+}
+
 // Recombines the result's parts into {Z}, after backwards FFT.
 void FFTContainer::NormalizeAndRecombine(int omega, int m, RWDigits Z,
                                          int chunk_size) {
@@ -721,8 +745,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +757,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -750,7 +774,23 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+}
+
+// Same as {PointwiseMultiply}, but splits the parts into ranges that are
+// multiplied in parallel. Each range starts at an even index, since pairs of
+// parts are combined for the first level of the backwards FFT.
+void FFTContainer::PointwiseMultiply_Parallel(const FFTContainer& other) {
+  DCHECK(n_ == other.n_);
+  int tasks = std::min(processor_->max_parallelism(), n_ / 2);
+  int range = ((n_ / 2 + tasks - 1) / tasks) * 2;
+  tasks = (n_ + range - 1) / range;
+  processor_->ParallelFor(tasks, [&](ProcessorImpl* processor, int i) {
+    int start = i * range;
+    int end = std::min(start + range, n_);
+    ScratchDigits temp(2 * length_);
+    DoPointwiseMultiplication(other, start, end, temp.digits(), processor);
+  });
 }
 
 }  // namespace
@@ -770,6 +810,30 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int omega = params.r;  // really: 2^r
 
   FFTContainer a(params.n, params.K, this);
+  if (Y.len() >= kFftParallelThreshold && max_parallelism() > 1) {
+    // The forward transforms of both inputs, the pointwise multiplications
+    // and the two halves of the backwards transform are independent of each
+    // other, so they can run in parallel.
+    if (X == Y) {
+      a.Start(X, params.s, 0, omega);
+      a.PointwiseMultiply_Parallel(a);
+    } else {
+      FFTContainer b(params.n, params.K, this);
+      ParallelFor(2, [&](ProcessorImpl*, int i) {
+        if (i == 0) {
+          a.Start(X, params.s, 0, omega);
+        } else {
+          b.Start(Y, params.s, 0, omega);
+        }
+      });
+      a.PointwiseMultiply_Parallel(b);
+    }
+    if (should_terminate()) return;
+    a.BackwardFFT_Parallel(omega);
+    a.NormalizeAndRecombine(omega, m, Z, params.s);
+    return;
+  }
+
   a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
@@ -174,8 +174,8 @@ class ToStringFormatter {
   void Fast();
   char* FillWithZeros(RecursionLevel* level, char* prev_cursor, char* out,
                       bool is_last_on_level);
-  char* ProcessLevel(RecursionLevel* level, Digits chunk, char* out,
-                     bool is_last_on_level);
+  char* ProcessLevel(ProcessorImpl* processor, RecursionLevel* level,
+                     Digits chunk, char* out, bool is_last_on_level);
 
  private:
   // When processing the last (most significant) digit, don't write leading
@@ -422,7 +422,7 @@ void ToStringFormatter::Fast() {
   std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
       chunk_divisor_, chunk_chars_, BitLength(digits_), processor_));
   if (processor_->should_terminate()) return;
-  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true);
+  out_ = ProcessLevel(processor_, recursion_levels.get(), digits_, out_, true);
 }
 
 // Writes '0' characters right-to-left, starting at {out}-1, until the distance
@@ -443,7 +443,8 @@ char* ToStringFormatter::FillWithZeros(RecursionLevel* level,
   return out;
 }
 
-char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
+char* ToStringFormatter::ProcessLevel(ProcessorImpl* processor,
+                                      RecursionLevel* level, Digits chunk,
                                       char* out, bool is_last_on_level) {
   // Step 0: if only one digit is left, bail out to the base case.
   Digits normalized = chunk;
@@ -460,7 +461,8 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
   // even after left-shifting, fall through to the next level immediately.
   if (normalized.len() < level->divisor_.len()) {
     char* right_boundary = out;
-    out = ProcessLevel(level->next_, chunk, out, is_last_on_level);
+    out = ProcessLevel(processor, level->next_, chunk, out,
+                       is_last_on_level);
     return FillWithZeros(level, right_boundary, out, is_last_on_level);
   }
   // Step 2: Prepare the chunk.
@@ -483,7 +485,8 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
       chunk_shifted.Reset();
       // ...and otherwise undo the {chunk = chunk_shifted} assignment above.
       chunk = original_chunk;
-      out = ProcessLevel(level->next_, chunk, out, is_last_on_level);
+      out = ProcessLevel(processor, level->next_, chunk, out,
+                       is_last_on_level);
     } else {
       DCHECK(comparison == 0);
       // If the chunk is equal to the divisor, we know that the right half
@@ -505,22 +508,22 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
   // Step 4: Divide to split {chunk} into {left} and {right}.
   int inverse_len = chunk.len() - level->divisor_.len();
   if (inverse_len == 0) {
-    processor_->DivideSchoolbook(left, right, chunk, level->divisor_);
+    processor->DivideSchoolbook(left, right, chunk, level->divisor_);
   } else if (level->divisor_.len() == 1) {
-    processor_->DivideSingle(left, right.digits(), chunk, level->divisor_[0]);
+    processor->DivideSingle(left, right.digits(), chunk, level->divisor_[0]);
     for (int i = 1; i < right.len(); i++) right[i] = 0;
   } else {
     ScratchDigits scratch(DivideBarrettScratchSpace(chunk.len()));
     // The top level only computes its inverse when {chunk.len()} is
     // available. Other levels have precomputed theirs.
     if (level->is_toplevel_) {
-      level->ComputeInverse(processor_, chunk.len());
-      if (processor_->should_terminate()) return out;
+      level->ComputeInverse(processor, chunk.len());
+      if (processor->should_terminate()) return out;
     }
     Digits inverse = level->GetInverse(chunk.len());
-    processor_->DivideBarrett(left, right, chunk, level->divisor_, inverse,
+    processor->DivideBarrett(left, right, chunk, level->divisor_, inverse,
                               scratch);
-    if (processor_->should_terminate()) return out;
+    if (processor->should_terminate()) return out;
   }
   RightShift(right, right, level->leading_zero_shift_);
 #if DEBUG
@@ -530,15 +533,37 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 #endif
 
   // Step 5: Recurse.
-  char* end_of_right_part = ProcessLevel(level->next_, right, out, false);
-  if (processor_->should_terminate()) return out;
+  if (chunk.len() >= kToStringParallelThreshold &&
+      processor->max_parallelism() > 1) {
+    // The two halves write to disjoint parts of the output, so they can be
+    // processed in parallel.
+    char* end_of_left_part = nullptr;
+    processor->ParallelFor(2, [&](ProcessorImpl* task_processor, int i) {
+      if (i == 0) {
+        char* end_of_right_part =
+            ProcessLevel(task_processor, level->next_, right, out, false);
+        DCHECK(task_processor->should_terminate() ||
+               end_of_right_part == out - level->char_count_);
+        USE(end_of_right_part);
+      } else {
+        end_of_left_part =
+            ProcessLevel(task_processor, level->next_, left,
+                         out - level->char_count_, is_last_on_level);
+      }
+    });
+    if (processor->should_terminate()) return out;
+    return end_of_left_part;
+  }
+  char* end_of_right_part =
+      ProcessLevel(processor, level->next_, right, out, false);
+  if (processor->should_terminate()) return out;
   // The recursive calls are required and hence designed to write exactly as
   // many characters as their level is responsible for.
   DCHECK(end_of_right_part == out - level->char_count_);
   USE(end_of_right_part);
-  // We intentionally don't use {end_of_right_part} here to be prepared for
-  // potential future multi-threaded execution.
-  return ProcessLevel(level->next_, left, out - level->char_count_,
+  // We don't use {end_of_right_part} here, so that both halves can also be
+  // processed in parallel (see above).
+  return ProcessLevel(processor, level->next_, left, out - level->char_count_,
                       is_last_on_level);
 }
 
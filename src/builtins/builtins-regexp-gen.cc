@@ -472,6 +472,36 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
   to_direct.TryToDirect(&runtime);
 
+  // If every match contains a literal, search a long subject for it first to
+  // skip ahead, or fail without running the regexp at all.
+
+  TVARIABLE(IntPtrT, var_start_index, int_last_index);
+  {
+    Label next(this);
+    TNode<Object> required_literal =
+        LoadObjectField(data, IrRegExpData::kRequiredLiteralOffset);
+    GotoIf(IsUndefined(required_literal), &next);
+    GotoIf(IntPtrLessThan(
+               IntPtrSub(int_string_length, int_last_index),
+               IntPtrConstant(RegExp::kMinSubjectLengthForRequiredLiteral)),
+           &next);
+
+    TNode<ExternalReference> skip_function =
+        ExternalConstant(ExternalReference::re_skip_to_required_literal());
+    TNode<Int32T> start_index = UncheckedCast<Int32T>(CallCFunction(
+        skip_function, MachineType::Int32(),
+        std::make_pair(MachineType::AnyTagged(), string),
+        std::make_pair(MachineType::Int32(),
+                       TruncateIntPtrToInt32(int_last_index)),
+        std::make_pair(MachineType::AnyTagged(), data),
+        std::make_pair(MachineType::Pointer(), isolate_address)));
+    GotoIf(Int32LessThan(start_index, Int32Constant(0)), &if_failure);
+    var_start_index = ChangeInt32ToIntPtr(start_index);
+    Goto(&next);
+
+    BIND(&next);
+  }
+
   // Load the irregexp code or bytecode object and offsets into the subject
   // string. Both depend on whether the string is one- or two-byte.
 
@@ -493,9 +523,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_isonebyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::ONE_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::ONE_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code =
           LoadObjectField<kVarCodeT>(data, IrRegExpData::kLatin1CodeOffset);
       var_bytecode = LoadObjectField(data, IrRegExpData::kLatin1BytecodeOffset);
@@ -504,9 +535,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_istwobyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::TWO_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::TWO_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code =
           LoadObjectField<kVarCodeT>(data, IrRegExpData::kUc16CodeOffset);
       var_bytecode = LoadObjectField(data, IrRegExpData::kUc16BytecodeOffset);
@@ -546,7 +578,7 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     // Argument 1: Previous index.
     MachineType arg1_type = type_int32;
-    TNode<Int32T> arg1 = TruncateIntPtrToInt32(int_last_index);
+    TNode<Int32T> arg1 = TruncateIntPtrToInt32(var_start_index.value());
 
     // Argument 2: Start of string data. This argument is ignored in the
     // interpreter.
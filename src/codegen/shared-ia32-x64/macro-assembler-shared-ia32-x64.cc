@@ -394,10 +394,18 @@ void SharedMacroAssemblerBase::I8x16SplatPreAvx2(XMMRegister dst, Op src,
                                                  XMMRegister scratch) {
   ASM_CODE_COMMENT(this);
   DCHECK(!CpuFeatures::IsSupported(AVX2));
-  CpuFeatureScope ssse3_scope(this, SSSE3);
   Movd(dst, src);
-  Xorps(scratch, scratch);
-  Pshufb(dst, scratch);
+  if (CpuFeatures::IsSupported(SSSE3)) {
+    CpuFeatureScope ssse3_scope(this, SSSE3);
+    Xorps(scratch, scratch);
+    Pshufb(dst, scratch);
+  } else {
+    // SSE2 only, which is used by builtins (e.g. the SwissNameDictionary
+    // lookups) that are compiled into the snapshot for the baseline CPU.
+    Punpcklbw(dst, dst);
+    Pshuflw(dst, dst, uint8_t{0});
+    Pshufd(dst, dst, uint8_t{0});
+  }
 }
 
 void SharedMacroAssemblerBase::I8x16Splat(XMMRegister dst, Register src,
@@ -96,8 +96,11 @@ OverloadsResolutionResult ResolveOverloads(
       }
     }
 
+    // A FastApiArrayBufferView argument accepts typed arrays of every
+    // elements kind, so it can't be told apart from a sequence at runtime.
     if (index_of_func_with_js_array_arg >= 0 &&
-        index_of_func_with_typed_array_arg >= 0) {
+        index_of_func_with_typed_array_arg >= 0 &&
+        element_type != CTypeInfo::Type::kVoid) {
       return {static_cast<int>(arg_index), element_type};
     }
   }
@@ -286,15 +286,32 @@ class FastApiCallLoweringReducer : public Next {
               V<Map> map = __ LoadMapField(argument_obj);
               V<Word32> instance_type = __ LoadInstanceTypeField(map);
 
+              // Look through a ThinString, which is what internalizing a
+              // string in place leaves behind.
+              Label<HeapObject, Word32> check_string(this);
+              GOTO_IF_NOT(
+                  UNLIKELY(__ Word32Equal(
+                      __ Word32BitwiseAnd(instance_type,
+                                          kIsNotStringMask |
+                                              kStringRepresentationMask),
+                      kThinStringTag)),
+                  check_string, argument_obj, instance_type);
+              V<HeapObject> actual = __ template LoadField<HeapObject>(
+                  argument_obj, AccessBuilder::ForThinStringActual());
+              GOTO(check_string, actual,
+                   __ LoadInstanceTypeField(__ LoadMapField(actual)));
+
+              BIND(check_string, string, string_instance_type);
               V<Word32> encoding = __ Word32BitwiseAnd(
-                  instance_type, kStringRepresentationAndEncodingMask);
+                  string_instance_type,
+                  kIsNotStringMask | kStringRepresentationAndEncodingMask);
               GOTO_IF_NOT(__ Word32Equal(encoding, kSeqOneByteStringTag),
                           handle_error);
 
               V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
-                  argument_obj, AccessBuilder::ForStringLength());
+                  string, AccessBuilder::ForStringLength());
               V<WordPtr> data_ptr = __ GetElementStartPointer(
-                  argument_obj, AccessBuilder::ForSeqOneByteStringCharacter());
+                  string, AccessBuilder::ForSeqOneByteStringCharacter());
 
               constexpr int kAlign = alignof(FastOneByteString);
               constexpr int kSize = sizeof(FastOneByteString);
@@ -335,6 +352,13 @@ class FastApiCallLoweringReducer : public Next {
         // Check that the value is a HeapObject.
         GOTO_IF(__ ObjectIsSmi(argument), handle_error);
 
+        if (arg_type.GetType() == CTypeInfo::Type::kVoid) {
+          return AdaptFastCallArrayBufferViewArgument(
+              argument,
+              static_cast<uint8_t>(arg_type.GetFlags()) &
+                  static_cast<uint8_t>(CTypeInfo::Flags::kAllowSharedBit),
+              handle_error);
+        }
         return AdaptFastCallTypedArrayArgument(
             argument,
             fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
@@ -428,31 +452,7 @@ class FastApiCallLoweringReducer : public Next {
 
     // Unpack the store and length, and store them to a struct
     // FastApiTypedArray.
-    OpIndex external_pointer =
-        __ LoadField(argument, AccessBuilder::ForJSTypedArrayExternalPointer());
-
-    // Load the base pointer for the buffer. This will always be Smi
-    // zero unless we allow on-heap TypedArrays, which is only the case
-    // for Chrome. Node and Electron both set this limit to 0. Setting
-    // the base to Smi zero here allows the BuildTypedArrayDataPointer
-    // to optimize away the tricky part of the access later.
-    V<WordPtr> data_ptr;
-    if constexpr (JSTypedArray::kMaxSizeInHeap == 0) {
-      data_ptr = external_pointer;
-    } else {
-      V<Object> base_pointer = __ template LoadField<Object>(
-          argument, AccessBuilder::ForJSTypedArrayBasePointer());
-      V<WordPtr> base = __ BitcastTaggedToWordPtr(base_pointer);
-      if (COMPRESS_POINTERS_BOOL) {
-        // Zero-extend Tagged_t to UintPtr according to current compression
-        // scheme so that the addition with |external_pointer| (which already
-        // contains compensated offset value) will decompress the tagged value.
-        // See JSTypedArray::ExternalPointerCompensationForOnHeapArray() for
-        // details.
-        base = __ ChangeUint32ToUintPtr(__ TruncateWordPtrToWord32(base));
-      }
-      data_ptr = __ WordPtrAdd(base, external_pointer);
-    }
+    V<WordPtr> data_ptr = LoadTypedArrayDataPointer(argument);
 
     V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
         argument, AccessBuilder::ForJSTypedArrayLength());
@@ -484,6 +484,87 @@ class FastApiCallLoweringReducer : public Next {
     return stack_slot;
   }
 
+  // Passes a typed array of any elements kind as a FastApiArrayBufferView
+  // that points into its backing store.
+  OpIndex AdaptFastCallArrayBufferViewArgument(V<HeapObject> argument,
+                                               bool allow_shared,
+                                               Label<>& bailout) {
+    V<Map> map = __ LoadMapField(argument);
+    V<Word32> instance_type = __ LoadInstanceTypeField(map);
+    GOTO_IF_NOT(LIKELY(__ Word32Equal(instance_type, JS_TYPED_ARRAY_TYPE)),
+                bailout);
+
+    // Go to the slow path if the byte length of the view can change, as it
+    // isn't stored in the view then.
+    V<Word32> view_bitfield = __ template LoadField<Word32>(
+        argument, AccessBuilder::ForJSArrayBufferViewBitField());
+    GOTO_IF(UNLIKELY(__ Word32BitwiseAnd(
+                view_bitfield, JSArrayBufferView::IsLengthTrackingBit::kMask |
+                                   JSArrayBufferView::IsBackedByRabBit::kMask)),
+            bailout);
+
+    V<HeapObject> buffer = __ template LoadField<HeapObject>(
+        argument, AccessBuilder::ForJSArrayBufferViewBuffer());
+    V<Word32> buffer_bitfield = __ template LoadField<Word32>(
+        buffer, AccessBuilder::ForJSArrayBufferBitField());
+
+    // Go to the slow path if the {buffer} was detached.
+    GOTO_IF(UNLIKELY(__ Word32BitwiseAnd(buffer_bitfield,
+                                         JSArrayBuffer::WasDetachedBit::kMask)),
+            bailout);
+
+    if (!allow_shared) {
+      // Go to the slow path if the {buffer} is shared.
+      GOTO_IF(UNLIKELY(__ Word32BitwiseAnd(buffer_bitfield,
+                                           JSArrayBuffer::IsSharedBit::kMask)),
+              bailout);
+    }
+
+    V<WordPtr> data_ptr = LoadTypedArrayDataPointer(argument);
+    V<WordPtr> byte_length = __ template LoadField<WordPtr>(
+        argument, AccessBuilder::ForJSArrayBufferViewByteLength());
+
+    constexpr int kAlign = alignof(FastApiArrayBufferView);
+    constexpr int kSize = sizeof(FastApiArrayBufferView);
+    static_assert(kSize == sizeof(uintptr_t) + sizeof(size_t),
+                  "The size of FastApiArrayBufferView isn't equal to the sum "
+                  "of its expected members.");
+    static_assert(offsetof(FastApiArrayBufferView, byte_length) ==
+                  sizeof(uintptr_t));
+    OpIndex stack_slot = __ StackSlot(kSize, kAlign);
+    __ StoreOffHeap(stack_slot, data_ptr, MemoryRepresentation::UintPtr());
+    __ StoreOffHeap(stack_slot, byte_length, MemoryRepresentation::UintPtr(),
+                    sizeof(uintptr_t));
+    return stack_slot;
+  }
+
+  V<WordPtr> LoadTypedArrayDataPointer(V<HeapObject> typed_array) {
+    OpIndex external_pointer = __ LoadField(
+        typed_array, AccessBuilder::ForJSTypedArrayExternalPointer());
+
+    // Load the base pointer for the buffer. This will always be Smi
+    // zero unless we allow on-heap TypedArrays, which is only the case
+    // for Chrome. Node and Electron both set this limit to 0. Setting
+    // the base to Smi zero here allows the BuildTypedArrayDataPointer
+    // to optimize away the tricky part of the access later.
+    if constexpr (JSTypedArray::kMaxSizeInHeap == 0) {
+      return external_pointer;
+    } else {
+      V<Object> base_pointer = __ template LoadField<Object>(
+          typed_array, AccessBuilder::ForJSTypedArrayBasePointer());
+      V<WordPtr> base = __ BitcastTaggedToWordPtr(base_pointer);
+      if (COMPRESS_POINTERS_BOOL) {
+        // Zero-extend Tagged_t to UintPtr according to current compression
+        // scheme so that the addition with |external_pointer| (which already
+        // contains compensated offset value) will decompress the tagged value.
+        // See JSTypedArray::ExternalPointerCompensationForOnHeapArray() for
+        // details.
+        base = __ ChangeUint32ToUintPtr(__ TruncateWordPtrToWord32(base));
+      }
+      return __ WordPtrAdd(base, external_pointer);
+    }
+  }
+
   V<Object> ConvertReturnValue(const CFunctionInfo* c_signature,
                                OpIndex result) {
     switch (c_signature->ReturnInfo().GetType()) {
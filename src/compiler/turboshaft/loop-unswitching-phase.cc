@@ -0,0 +1,22 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-unswitching-phase.h"
+
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/loop-unswitching-reducer.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/partial-redundancy-elimination-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void LoopUnswitchingPhase::Run(PipelineData* data, Zone* temp_zone) {
+  turboshaft::CopyingPhase<LoopUnswitchingReducer,
+                           PartialRedundancyEliminationReducer,
+                           MachineOptimizationReducer,
+                           ValueNumberingReducer>::Run(data, temp_zone);
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,146 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_UNSWITCHING_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_UNSWITCHING_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/flags/flags.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+template <class Next>
+class LoopPeelingReducer;
+template <class Next>
+class LoopUnrollingReducer;
+
+// LoopUnswitching moves loop-invariant branches out of innermost loops. A loop
+// like
+//
+//     for (...) { if (flag) { A } else { B } C }
+//
+// is emitted twice, guarded by `flag`:
+//
+//     if (flag) { for (...) { A C } } else { for (...) { B C } }
+//
+// Since the whole loop is duplicated, only loops whose size is below
+// --turboshaft-loop-unswitching-max-size are unswitched, each loop is
+// unswitched at most once per phase, and the loops that are unswitched in a
+// function add at most --turboshaft-loop-unswitching-budget operations.
+
+template <class Next>
+class LoopUnswitchingReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopUnswitching)
+
+#if defined(__clang__)
+  // Like LoopPeeling and LoopUnrolling, LoopUnswitching relies on being the
+  // only reducer of the phase that duplicates loops.
+  static_assert(!reducer_list_contains<ReducerList, LoopPeelingReducer>::value);
+  static_assert(
+      !reducer_list_contains<ReducerList, LoopUnrollingReducer>::value);
+#endif
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    const Block* dst = gto.destination;
+    if (unswitched_branch_ == nullptr && dst->IsLoop() && !gto.is_backedge) {
+      const BranchOp* branch = FindInvariantBranch(dst);
+      if (branch == nullptr) goto no_change;
+      if (ShouldSkipOptimizationStep()) goto no_change;
+      UnswitchLoop(dst, branch);
+      return {};
+    }
+
+    goto no_change;
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Branch)(OpIndex ig_idx, const BranchOp& branch) {
+    if (&branch != unswitched_branch_) {
+      return Next::ReduceInputGraphBranch(ig_idx, branch);
+    }
+
+    // In each copy of the loop, the outcome of the unswitched branch is known.
+    __ Goto(__ MapToNewGraph(unswitched_branch_value_ ? branch.if_true
+                                                      : branch.if_false));
+    return OpIndex::Invalid();
+  }
+
+ private:
+  void UnswitchLoop(const Block* header, const BranchOp* branch) {
+    DCHECK_NULL(unswitched_branch_);
+    auto loop_body = loop_finder_.GetLoopBody(header);
+    remaining_budget_ -= loop_finder_.GetLoopInfo(header).op_count;
+
+    // {FindInvariantBranch} checked that the condition is defined outside of
+    // the loop, which means that it dominates the loop header and is thus
+    // already available here.
+    V<Word32> condition =
+        V<Word32>::Cast(__ MapToNewGraph(branch->condition()));
+    Block* if_true = __ NewBlock();
+    Block* if_false = __ NewBlock();
+    __ Branch(condition, if_true, if_false, branch->hint);
+
+    ScopedModification<const BranchOp*> set_branch(&unswitched_branch_,
+                                                   branch);
+    for (bool value : {true, false}) {
+      // One of the blocks might not be reachable if MachineOptimization managed
+      // to constant-fold {condition}.
+      if (!__ Bind(value ? if_true : if_false)) continue;
+      unswitched_branch_value_ = value;
+      __ CloneSubGraph(loop_body, /* keep_loop_kinds */ true);
+    }
+  }
+
+  const BranchOp* FindInvariantBranch(const Block* header) {
+    LoopFinder::LoopInfo info = loop_finder_.GetLoopInfo(header);
+    if (info.has_inner_loops) return nullptr;
+    // Unswitching duplicates the whole loop, so {op_count} is also (an upper
+    // bound of) the number of operations that it adds to the graph.
+    if (info.op_count >
+        static_cast<size_t>(v8_flags.turboshaft_loop_unswitching_max_size)) {
+      return nullptr;
+    }
+    if (info.op_count > remaining_budget_) return nullptr;
+
+    auto loop_body = loop_finder_.GetLoopBody(header);
+    const Graph& graph = __ input_graph();
+    for (const Block* block : loop_body) {
+      const BranchOp* branch =
+          block->LastOperation(graph).template TryCast<BranchOp>();
+      if (branch == nullptr) continue;
+      const Block* condition_block =
+          &graph.Get(graph.BlockIndexOf(branch->condition()));
+      if (loop_body.find(condition_block) == loop_body.end()) return branch;
+    }
+    return nullptr;
+  }
+
+  // The branch being unswitched, or nullptr if we are not currently emitting
+  // an unswitched loop.
+  const BranchOp* unswitched_branch_ = nullptr;
+  // The value of the condition of {unswitched_branch_} in the copy of the loop
+  // that is currently being emitted.
+  bool unswitched_branch_value_ = false;
+  // The number of operations that unswitching can still add to the graph.
+  size_t remaining_budget_ =
+      static_cast<size_t>(v8_flags.turboshaft_loop_unswitching_budget);
+
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_UNSWITCHING_REDUCER_H_
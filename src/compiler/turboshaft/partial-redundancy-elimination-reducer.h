@@ -0,0 +1,192 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_PARTIAL_REDUNDANCY_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_PARTIAL_REDUNDANCY_ELIMINATION_REDUCER_H_
+
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/uniform-reducer-adapter.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// PartialRedundancyElimination hoists operations that are computed on both
+// sides of a diamond above the branch:
+//
+//        Branch(c)                         x = a + b
+//        /       \                         Branch(c)
+//   x = a + b   y = a + b      ==>        /         \
+//      ...         ...                  ...         ...
+//
+// The operation is emitted once before the branch, and both of its copies in
+// the successors are mapped to it when their blocks are visited.
+//
+// Only operations whose inputs are all defined before the branch, and that can
+// be reordered with all of the preceding operations of their block (according
+// to their OpEffects) are considered. Since the operation was executed on both
+// paths anyways, hoisting it is never speculative.
+
+template <class Next>
+class PartialRedundancyEliminationReducer
+    : public UniformReducerAdapter<PartialRedundancyEliminationReducer, Next> {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(PartialRedundancyElimination)
+
+  using Adapter =
+      UniformReducerAdapter<PartialRedundancyEliminationReducer, Next>;
+
+  OpIndex REDUCE_INPUT_GRAPH(Branch)(OpIndex ig_idx, const BranchOp& branch) {
+    // If this branch was emitted before (in another copy of a cloned loop),
+    // operations of its successors might still be mapped to the operations
+    // hoisted then, which don't dominate this copy.
+    ForgetHoisted(branch.if_true);
+    ForgetHoisted(branch.if_false);
+    if (!ShouldSkipOptimizationStep() &&
+        !__ generating_unreachable_operations()) {
+      HoistCommonOperations(branch);
+      __ SetCurrentOrigin(ig_idx);
+    }
+    return Next::ReduceInputGraphBranch(ig_idx, branch);
+  }
+
+  template <typename Op, typename Continuation>
+  OpIndex ReduceInputGraphOperation(OpIndex ig_idx, const Op& op) {
+    if (!emitting_hoisted_) {
+      auto it = hoisted_.find(ig_idx.id());
+      if (it != hoisted_.end()) {
+        OpIndex hoisted = it->second;
+        hoisted_.erase(it);
+        return hoisted;
+      }
+    }
+    return Continuation{this}.ReduceInputGraph(ig_idx, op);
+  }
+
+ private:
+  // We only look at the first few operations of each successor, since the
+  // matching is quadratic in the number of candidates.
+  static constexpr size_t kMaxCandidatesPerBlock = 16;
+
+  using Candidates = base::SmallVector<OpIndex, kMaxCandidatesPerBlock>;
+
+  void HoistCommonOperations(const BranchOp& branch) {
+    const Block* if_true = branch.if_true;
+    const Block* if_false = branch.if_false;
+    if (if_true->PredecessorCount() != 1 || if_false->PredecessorCount() != 1) {
+      return;
+    }
+
+    Candidates false_candidates;
+    CollectCandidates(if_false, &false_candidates);
+    if (false_candidates.empty()) return;
+    Candidates true_candidates;
+    CollectCandidates(if_true, &true_candidates);
+
+    const Graph& graph = __ input_graph();
+    for (OpIndex true_idx : true_candidates) {
+      const Operation& true_op = graph.Get(true_idx);
+      for (OpIndex& false_idx : false_candidates) {
+        if (!false_idx.valid()) continue;
+        if (!EqualsForGVN(true_op, graph.Get(false_idx))) continue;
+        // Emitting {true_op} in the current block. Both {true_op} and its copy
+        // from {if_false} are mapped to it when their blocks are visited.
+        OpIndex hoisted = EmitHoisted(true_idx, true_op);
+        if (hoisted.valid()) {
+          hoisted_[true_idx.id()] = hoisted;
+          hoisted_[false_idx.id()] = hoisted;
+        }
+        false_idx = OpIndex::Invalid();
+        break;
+      }
+    }
+  }
+
+  // Emits a copy of {op} without mapping {ig_idx} to it, since {ig_idx} is
+  // still going to be visited as part of its own block.
+  OpIndex EmitHoisted(OpIndex ig_idx, const Operation& op) {
+    ScopedModification<bool> set_emitting(&emitting_hoisted_, true);
+    __ SetCurrentOrigin(ig_idx);
+    switch (op.opcode) {
+#define CASE(Name)      \
+  case Opcode::k##Name: \
+    return __ ReduceInputGraph##Name(ig_idx, op.Cast<Name##Op>());
+      TURBOSHAFT_OPERATION_LIST(CASE)
+#undef CASE
+    }
+    UNREACHABLE();
+  }
+
+  void ForgetHoisted(const Block* block) {
+    if (hoisted_.empty()) return;
+    hoisted_.erase(hoisted_.lower_bound(block->begin().id()),
+                   hoisted_.lower_bound(block->end().id()));
+  }
+
+  void CollectCandidates(const Block* block, Candidates* candidates) {
+    const Graph& graph = __ input_graph();
+    // The effects produced by the operations of {block} that we've visited so
+    // far. An operation can be hoisted only if it doesn't consume any of them.
+    EffectDimensions produced;
+    for (OpIndex idx : graph.OperationIndices(*block)) {
+      const Operation& op = graph.Get(idx);
+      OpEffects effects = op.Effects();
+      if (IsHoistable(op, effects, block) &&
+          (effects.consumes.bits() & produced.bits()) == 0) {
+        candidates->push_back(idx);
+        if (candidates->size() == kMaxCandidatesPerBlock) return;
+      }
+      produced = EffectDimensions::FromBits(static_cast<EffectDimensions::Bits>(
+          produced.bits() | effects.produces.bits()));
+    }
+  }
+
+  bool IsHoistable(const Operation& op, OpEffects effects,
+                   const Block* block) {
+    if (op.input_count == 0 || op.Is<PhiOp>() || op.Is<FrameStateOp>()) {
+      return false;
+    }
+    if (effects.produces.bits() != 0 || effects.required_when_unused ||
+        effects.can_create_identity || effects.can_allocate) {
+      return false;
+    }
+    if (op.outputs_rep().size() != 1) return false;
+    const Graph& graph = __ input_graph();
+    for (OpIndex input : op.inputs()) {
+      if (graph.BlockIndexOf(input) == block->index()) return false;
+    }
+    return true;
+  }
+
+  static bool EqualsForGVN(const Operation& a, const Operation& b) {
+    if (a.opcode != b.opcode) return false;
+    switch (a.opcode) {
+#define CASE(Name)      \
+  case Opcode::k##Name: \
+    return a.Cast<Name##Op>().EqualsForGVN(b.Cast<Name##Op>());
+      TURBOSHAFT_OPERATION_LIST(CASE)
+#undef CASE
+    }
+    UNREACHABLE();
+  }
+
+  // The operations that were hoisted above a branch, by the id of their copies
+  // in the input graph, which are removed when they are visited.
+  ZoneMap<uint32_t, OpIndex> hoisted_{__ phase_zone()};
+  // Whether a hoisted operation is being emitted, in which case it must not be
+  // replaced by itself.
+  bool emitting_hoisted_ = false;
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_PARTIAL_REDUNDANCY_ELIMINATION_REDUCER_H_
@@ -20,6 +20,7 @@
 #include "src/compiler/turboshaft/instruction-selection-phase.h"
 #include "src/compiler/turboshaft/loop-peeling-phase.h"
 #include "src/compiler/turboshaft/loop-unrolling-phase.h"
+#include "src/compiler/turboshaft/loop-unswitching-phase.h"
 #include "src/compiler/turboshaft/machine-lowering-phase.h"
 #include "src/compiler/turboshaft/maglev-graph-building-phase.h"
 #include "src/compiler/turboshaft/optimize-phase.h"
@@ -170,6 +171,13 @@ class Pipeline {
 
     Run<turboshaft::MachineLoweringPhase>();
 
+    // Unswitching runs before peeling and unrolling, since it only applies to
+    // loops that are still small enough to be duplicated, and it exposes
+    // branch-free loops to the subsequent phases.
+    if (v8_flags.turboshaft_loop_unswitching) {
+      Run<turboshaft::LoopUnswitchingPhase>();
+    }
+
     // TODO(dmercadier): find a way to merge LoopPeeling and LoopUnrolling. It's
     // not currently possible for 2 reasons. First, LoopPeeling reduces the
     // number of iteration of a loop, thus invalidating LoopUnrolling's
@@ -0,0 +1,358 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-bounds-check-elimination-reducer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/wasm/wasm-module.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+namespace {
+
+// Limits for the (recursive) upper bound computation, to keep the analysis
+// linear in practice.
+constexpr int kMaxUpperBoundDepth = 8;
+constexpr int kMaxDominatorSteps = 32;
+// Maximal number of dominating checks that we remember per (index, size) pair.
+constexpr size_t kMaxDominatingChecksPerKey = 16;
+
+uint64_t MaxSignedValue(RegisterRepresentation rep) {
+  return rep == RegisterRepresentation::Word32()
+             ? uint64_t{std::numeric_limits<int32_t>::max()}
+             : uint64_t{std::numeric_limits<int64_t>::max()};
+}
+
+void Refine(std::optional<uint64_t>& result, std::optional<uint64_t> bound) {
+  if (bound.has_value() && (!result.has_value() || *bound < *result)) {
+    result = bound;
+  }
+}
+
+}  // namespace
+
+WasmBoundsCheckAnalyzer::WasmBoundsCheckAnalyzer(PipelineData* data,
+                                                 const Graph& graph,
+                                                 Zone* phase_zone)
+    : graph_(graph),
+      phase_zone_(phase_zone),
+      matcher_(graph),
+      actions_(graph.op_id_count(), phase_zone, &graph),
+      widened_end_offsets_(graph.op_id_count(), phase_zone, &graph),
+      dominating_checks_(phase_zone) {
+  if (const wasm::WasmModule* module = data->wasm_module()) {
+    if (!module->memories.empty()) {
+      min_memory_size_ = std::numeric_limits<uint64_t>::max();
+      for (const wasm::WasmMemory& memory : module->memories) {
+        min_memory_size_ =
+            std::min(min_memory_size_, uint64_t{memory.min_memory_size});
+      }
+    }
+  }
+}
+
+void WasmBoundsCheckAnalyzer::Run() {
+  // Blocks are ordered such that each block comes after its dominator, which
+  // means that dominating checks are always recorded before they are needed.
+  for (const Block& block : graph_.blocks()) {
+    ProcessBlock(block);
+  }
+}
+
+std::optional<WasmBoundsCheckAnalyzer::BoundsCheck>
+WasmBoundsCheckAnalyzer::MatchBoundsCheck(const Operation& op) const {
+  const TrapIfOp* trap = op.TryCast<TrapIfOp>();
+  if (trap == nullptr || !trap->negated ||
+      trap->trap_id != TrapId::kTrapMemOutOfBounds ||
+      trap->frame_state().valid()) {
+    return std::nullopt;
+  }
+  const ComparisonOp* comparison =
+      graph_.Get(trap->condition()).TryCast<ComparisonOp>();
+  if (comparison == nullptr ||
+      comparison->kind != ComparisonOp::Kind::kUnsignedLessThan ||
+      comparison->rep != RegisterRepresentation::WordPtr()) {
+    return std::nullopt;
+  }
+
+  uint64_t constant;
+  if (matcher_.MatchUnsignedIntegralConstant(comparison->left(), &constant)) {
+    // `end_offset < size`.
+    return BoundsCheck{OpIndex::Invalid(), comparison->right(), constant};
+  }
+  if (matcher_.MatchUnsignedIntegralConstant(comparison->right(), &constant)) {
+    // Comparisons against a constant (like the memory64 guard region check)
+    // don't involve the memory size.
+    return std::nullopt;
+  }
+  if (const WordBinopOp* sub =
+          graph_.Get(comparison->right()).TryCast<WordBinopOp>();
+      sub != nullptr && sub->kind == WordBinopOp::Kind::kSub) {
+    if (!matcher_.MatchUnsignedIntegralConstant(sub->right(), &constant)) {
+      return std::nullopt;
+    }
+    // `index < size - end_offset`.
+    return BoundsCheck{comparison->left(), sub->left(), constant};
+  }
+  // `index < size`, where a subtraction of 0 has already been folded.
+  return BoundsCheck{comparison->left(), comparison->right(), 0};
+}
+
+void WasmBoundsCheckAnalyzer::ProcessBlock(const Block& block) {
+  // The first check for each (index, size) pair since the last operation with
+  // side effects. Later checks of the same pair are merged into it.
+  ZoneAbslFlatHashMap<uint64_t, OpIndex> segment(phase_zone_);
+
+  for (OpIndex op_index : graph_.OperationIndices(block)) {
+    const Operation& op = graph_.Get(op_index);
+    std::optional<BoundsCheck> check = MatchBoundsCheck(op);
+    if (!check.has_value()) {
+      OpEffects effects = op.Effects();
+      if (effects.produces.control_flow || effects.can_write() ||
+          effects.required_when_unused) {
+        segment.clear();
+      }
+      continue;
+    }
+
+    if (IsRedundant(block, *check)) {
+      actions_[op_index] = Action::kRemove;
+      continue;
+    }
+
+    auto it = segment.find(Key(*check));
+    // The subtraction `size - end_offset` must not underflow, which is only
+    // guaranteed for end offsets below the minimum memory size.
+    bool can_widen =
+        !check->index.valid() || check->end_offset <= min_memory_size_;
+    if (it == segment.end() || !can_widen) {
+      segment[Key(*check)] = op_index;
+      // The check covers its own end offset if it is widened later.
+      widened_end_offsets_[op_index] = check->end_offset;
+      RecordCheck(block, *check);
+      continue;
+    }
+
+    // Widen the first check of the segment to also cover this one. Nothing
+    // observable happens in between, so trapping earlier is fine.
+    OpIndex first = it->second;
+    actions_[first] = Action::kWiden;
+    widened_end_offsets_[first] =
+        std::max(widened_end_offsets_[first], check->end_offset);
+    actions_[op_index] = Action::kRemove;
+    RecordCheck(block, *check);
+  }
+}
+
+bool WasmBoundsCheckAnalyzer::IsRedundant(const Block& block,
+                                          const BoundsCheck& check) const {
+  // A dominating check with a larger or equal end offset implies this check.
+  auto it = dominating_checks_.find(Key(check));
+  if (it != dominating_checks_.end()) {
+    for (const DominatingCheck& dominating : it->second) {
+      if (dominating.end_offset >= check.end_offset &&
+          (dominating.block == &block ||
+           block.IsDominatedBy(dominating.block))) {
+        return true;
+      }
+    }
+  }
+
+  // The access is within the smallest possible memory.
+  if (check.end_offset >= min_memory_size_) return false;
+  if (!check.index.valid()) return true;
+  std::optional<uint64_t> upper_bound = UpperBound(check.index, block, 0);
+  return upper_bound.has_value() &&
+         *upper_bound < min_memory_size_ - check.end_offset;
+}
+
+void WasmBoundsCheckAnalyzer::RecordCheck(const Block& block,
+                                          const BoundsCheck& check) {
+  auto it = dominating_checks_.find(Key(check));
+  if (it == dominating_checks_.end()) {
+    it = dominating_checks_
+             .emplace(Key(check), ZoneVector<DominatingCheck>(phase_zone_))
+             .first;
+  }
+  ZoneVector<DominatingCheck>& checks = it->second;
+  if (checks.size() == kMaxDominatingChecksPerKey) return;
+  checks.push_back({&block, check.end_offset});
+}
+
+std::optional<uint64_t> WasmBoundsCheckAnalyzer::UpperBound(
+    OpIndex value, const Block& block, int depth) const {
+  if (depth > kMaxUpperBoundDepth) return std::nullopt;
+
+  uint64_t constant;
+  if (matcher_.MatchUnsignedIntegralConstant(value, &constant)) {
+    return constant;
+  }
+
+  std::optional<uint64_t> result;
+  const Operation& op = graph_.Get(value);
+  if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+    if (change->kind == ChangeOp::Kind::kZeroExtend) {
+      Refine(result, UpperBound(change->input(), block, depth + 1));
+      if (change->from == RegisterRepresentation::Word32()) {
+        Refine(result, std::numeric_limits<uint32_t>::max());
+      }
+    }
+  } else if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+    if (binop->kind == WordBinopOp::Kind::kBitwiseAnd) {
+      if (matcher_.MatchUnsignedIntegralConstant(binop->right(), &constant) ||
+          matcher_.MatchUnsignedIntegralConstant(binop->left(), &constant)) {
+        Refine(result, constant);
+      }
+    }
+  } else if (const PhiOp* phi = op.TryCast<PhiOp>()) {
+    Refine(result, InductionVariableUpperBound(*phi, depth + 1));
+  }
+
+  Refine(result, UpperBoundFromBranches(value, block, nullptr, false));
+  return result;
+}
+
+// Computes an upper bound for loop phis of the shape
+//
+//     phi = Phi(init, phi + step)
+//
+// with constants `init >= 0` and `step > 0`, where the backedge is only taken
+// if `phi` or `phi + step` are below some constant bound. As long as the
+// increment cannot overflow, this bound (plus {step}) holds for all values of
+// the phi.
+std::optional<uint64_t> WasmBoundsCheckAnalyzer::InductionVariableUpperBound(
+    const PhiOp& phi, int depth) const {
+  if (depth > kMaxUpperBoundDepth || phi.input_count != 2) return std::nullopt;
+  if (phi.rep != RegisterRepresentation::Word32() &&
+      phi.rep != RegisterRepresentation::Word64()) {
+    return std::nullopt;
+  }
+  OpIndex phi_index = graph_.Index(phi);
+  const Block& header = graph_.Get(graph_.BlockIndexOf(phi_index));
+  if (!header.IsLoop()) return std::nullopt;
+
+  uint64_t max_value = MaxSignedValue(phi.rep);
+  uint64_t init;
+  if (!matcher_.MatchUnsignedIntegralConstant(phi.input(0), &init) ||
+      init > max_value) {
+    return std::nullopt;
+  }
+
+  OpIndex backedge_value = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+  const WordBinopOp* add = graph_.Get(backedge_value).TryCast<WordBinopOp>();
+  if (add == nullptr || add->kind != WordBinopOp::Kind::kAdd ||
+      add->rep != phi.rep) {
+    return std::nullopt;
+  }
+  uint64_t step;
+  if (!(add->left() == phi_index &&
+        matcher_.MatchUnsignedIntegralConstant(add->right(), &step)) &&
+      !(add->right() == phi_index &&
+        matcher_.MatchUnsignedIntegralConstant(add->left(), &step))) {
+    return std::nullopt;
+  }
+  if (step == 0 || step > max_value) return std::nullopt;
+
+  // Look for a guard of the backedge. Since all the previous values of the
+  // phi are non-negative by induction, signed comparisons can be used too.
+  const Block& backedge_block = *header.LastPredecessor();
+  std::optional<uint64_t> bound;
+  if (std::optional<uint64_t> guard = UpperBoundFromBranches(
+          backedge_value, backedge_block, &header, true)) {
+    bound = std::max(init, *guard);
+  } else if (std::optional<uint64_t> guard = UpperBoundFromBranches(
+                 phi_index, backedge_block, &header, true)) {
+    if (*guard > max_value - step) return std::nullopt;
+    bound = std::max(init, *guard + step);
+  }
+  if (!bound.has_value() || *bound > max_value - step) return std::nullopt;
+  return bound;
+}
+
+std::optional<uint64_t> WasmBoundsCheckAnalyzer::UpperBoundFromBranches(
+    OpIndex value, const Block& from, const Block* stop,
+    bool assume_nonnegative) const {
+  std::optional<uint64_t> result;
+  int steps = 0;
+  for (const Block* block = &from;
+       block != nullptr && block != stop && steps < kMaxDominatorSteps;
+       block = block->GetDominator(), ++steps) {
+    if (block->PredecessorCount() != 1) continue;
+    const BranchOp* branch =
+        block->LastPredecessor()->LastOperation(graph_).TryCast<BranchOp>();
+    if (branch == nullptr || branch->if_true == branch->if_false) continue;
+    Refine(result,
+           UpperBoundFromCondition(value, branch->condition(),
+                                   branch->if_true == block,
+                                   assume_nonnegative));
+  }
+  return result;
+}
+
+std::optional<uint64_t> WasmBoundsCheckAnalyzer::UpperBoundFromCondition(
+    OpIndex value, OpIndex condition, bool condition_holds,
+    bool assume_nonnegative) const {
+  const ComparisonOp* comparison =
+      graph_.Get(condition).TryCast<ComparisonOp>();
+  if (comparison == nullptr) return std::nullopt;
+
+  bool is_signed;
+  bool or_equal;
+  switch (comparison->kind) {
+    case ComparisonOp::Kind::kEqual: {
+      if (!condition_holds) return std::nullopt;
+      uint64_t constant;
+      if ((comparison->left() == value &&
+           matcher_.MatchUnsignedIntegralConstant(comparison->right(),
+                                                  &constant)) ||
+          (comparison->right() == value &&
+           matcher_.MatchUnsignedIntegralConstant(comparison->left(),
+                                                  &constant))) {
+        return constant;
+      }
+      return std::nullopt;
+    }
+    case ComparisonOp::Kind::kSignedLessThan:
+      is_signed = true;
+      or_equal = false;
+      break;
+    case ComparisonOp::Kind::kSignedLessThanOrEqual:
+      is_signed = true;
+      or_equal = true;
+      break;
+    case ComparisonOp::Kind::kUnsignedLessThan:
+      is_signed = false;
+      or_equal = false;
+      break;
+    case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+      is_signed = false;
+      or_equal = true;
+      break;
+  }
+  // A signed comparison only bounds the unsigned value if it's non-negative.
+  if (is_signed && !assume_nonnegative) return std::nullopt;
+
+  // `value < bound` if the condition holds, or `!(bound < value)` otherwise.
+  OpIndex bounded = condition_holds ? comparison->left() : comparison->right();
+  OpIndex bound_index =
+      condition_holds ? comparison->right() : comparison->left();
+  uint64_t bound;
+  if (bounded != value ||
+      !matcher_.MatchUnsignedIntegralConstant(bound_index, &bound)) {
+    return std::nullopt;
+  }
+  if (is_signed && bound > MaxSignedValue(comparison->rep)) {
+    return std::nullopt;
+  }
+  // When the condition holds, `value <= bound` is inclusive for `or_equal`.
+  // Otherwise, `!(bound <= value)` means `value < bound`.
+  bool inclusive = condition_holds ? or_equal : !or_equal;
+  if (inclusive) return bound;
+  if (bound == 0) return std::nullopt;
+  return bound - 1;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,164 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include <optional>
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// The WasmBoundsCheckElimination removes explicit memory bounds checks, as
+// emitted for memory64 and for memories without trap handler guard regions.
+// These checks have the shape
+//
+//     TrapIfNot(UintPtrLessThan(index, WordPtrSub(mem_size, end_offset)))
+//     TrapIfNot(UintPtrLessThan(end_offset, mem_size))
+//
+// (the latter being equivalent to `0 < mem_size - end_offset`, and thus
+// treated as a check of a constant 0 index). A check is removed if
+//
+//   - a check with the same index and size and a larger or equal end offset
+//     dominates it, or
+//   - the upper bound of the index (computed from constants, masks,
+//     zero-extensions, dominating branches and loop induction variables) plus
+//     the end offset is below the minimum memory size.
+//
+// Additionally, within a sequence of operations without side effects, the
+// first check of each (index, size) pair is widened to the largest end offset
+// of the sequence, which makes the following checks redundant. Since nothing
+// observable happens between the checks, the only difference is the position
+// at which an out-of-bounds access traps.
+class WasmBoundsCheckAnalyzer {
+ public:
+  enum class Action : uint8_t { kKeep, kRemove, kWiden };
+
+  WasmBoundsCheckAnalyzer(PipelineData* data, const Graph& graph,
+                          Zone* phase_zone);
+
+  void Run();
+
+  Action GetAction(OpIndex trap) const { return actions_[trap]; }
+  uint64_t WidenedEndOffset(OpIndex trap) const {
+    DCHECK_EQ(GetAction(trap), Action::kWiden);
+    return widened_end_offsets_[trap];
+  }
+
+  // Matches a TrapIf {op} that checks `index < size - end_offset`. {index} is
+  // invalid for checks of a constant end offset against the memory size.
+  struct BoundsCheck {
+    OpIndex index;
+    OpIndex size;
+    uint64_t end_offset;
+  };
+  std::optional<BoundsCheck> MatchBoundsCheck(const Operation& op) const;
+
+ private:
+  struct DominatingCheck {
+    const Block* block;
+    uint64_t end_offset;
+  };
+
+  void ProcessBlock(const Block& block);
+  bool IsRedundant(const Block& block, const BoundsCheck& check) const;
+  void RecordCheck(const Block& block, const BoundsCheck& check);
+
+  std::optional<uint64_t> UpperBound(OpIndex value, const Block& block,
+                                     int depth) const;
+  std::optional<uint64_t> InductionVariableUpperBound(const PhiOp& phi,
+                                                      int depth) const;
+  std::optional<uint64_t> UpperBoundFromBranches(OpIndex value,
+                                                 const Block& from,
+                                                 const Block* stop,
+                                                 bool assume_nonnegative) const;
+  std::optional<uint64_t> UpperBoundFromCondition(OpIndex value,
+                                                  OpIndex condition,
+                                                  bool condition_holds,
+                                                  bool assume_nonnegative) const;
+
+  static uint64_t Key(const BoundsCheck& check) {
+    uint64_t index_key = check.index.valid() ? check.index.id() + 1 : 0;
+    return (index_key << 32) | check.size.id();
+  }
+
+  const Graph& graph_;
+  Zone* phase_zone_;
+  OperationMatcher matcher_;
+  // The smallest minimum size of all memories of the module. This is a
+  // conservative bound for the size of the memory that each check refers to.
+  uint64_t min_memory_size_ = 0;
+
+  FixedOpIndexSidetable<Action> actions_;
+  FixedOpIndexSidetable<uint64_t> widened_end_offsets_;
+  ZoneAbslFlatHashMap<uint64_t, ZoneVector<DominatingCheck>> dominating_checks_;
+};
+
+template <class Next>
+class WasmBoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmBoundsCheckElimination)
+
+  void Analyze() {
+    if (v8_flags.turboshaft_wasm_bounds_check_elimination) {
+      analyzer_.Run();
+    }
+    Next::Analyze();
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(TrapIf)(V<None> ig_index, const TrapIfOp& trap) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphTrapIf(ig_index, trap);
+    }
+    if (!v8_flags.turboshaft_wasm_bounds_check_elimination) goto no_change;
+
+    switch (analyzer_.GetAction(ig_index)) {
+      case WasmBoundsCheckAnalyzer::Action::kKeep:
+        goto no_change;
+      case WasmBoundsCheckAnalyzer::Action::kRemove:
+        if (ShouldSkipOptimizationStep()) goto no_change;
+        return V<None>::Invalid();
+      case WasmBoundsCheckAnalyzer::Action::kWiden: {
+        // Widened checks are always emitted, since subsequent checks might
+        // have been removed because of them.
+        std::optional<WasmBoundsCheckAnalyzer::BoundsCheck> check =
+            analyzer_.MatchBoundsCheck(trap);
+        DCHECK(check.has_value());
+        uint64_t end_offset = analyzer_.WidenedEndOffset(ig_index);
+        V<WordPtr> size = V<WordPtr>::Cast(__ MapToNewGraph(check->size));
+        V<Word32> condition =
+            check->index.valid()
+                ? __ UintPtrLessThan(
+                      V<WordPtr>::Cast(__ MapToNewGraph(check->index)),
+                      __ WordPtrSub(size, end_offset))
+                : __ UintPtrLessThan(__ UintPtrConstant(end_offset), size);
+        __ TrapIfNot(condition, trap.trap_id);
+        return V<None>::Invalid();
+      }
+    }
+  }
+
+ private:
+  WasmBoundsCheckAnalyzer analyzer_{Asm().data(), Asm().input_graph(),
+                                    Asm().phase_zone()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -310,6 +310,10 @@ class DelayedTasksPlatform final : public Platform {
       return job_task_->GetMaxConcurrency(worker_count);
     }
 
+    int GetNumaNodeHint() const override {
+      return job_task_->GetNumaNodeHint();
+    }
+
    private:
     std::unique_ptr<JobTask> job_task_;
     int32_t delay_ms_;
@@ -100,6 +100,47 @@ class FastCApiObject {
     CHECK_SELF_OR_THROW_SLOW();
     self->slow_call_count_++;
   }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType SumBytesFastCallbackPatch(AnyCType receiver, AnyCType view) {
+    AnyCType ret;
+    ret.uint32_value = SumBytesFastCallback(receiver.object_value,
+                                            *view.array_buffer_view_value);
+    return ret;
+  }
+
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static uint32_t SumBytesFastCallback(Local<Object> receiver,
+                                       const FastApiArrayBufferView& view) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    self->fast_call_count_++;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(view.data);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < view.byte_length; ++i) sum += bytes[i];
+    return sum;
+  }
+
+  static void SumBytesSlowCallback(const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    Isolate* isolate = info.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW_SLOW();
+    self->slow_call_count_++;
+
+    if (info.Length() < 1 || !info[0]->IsArrayBufferView()) {
+      isolate->ThrowError(
+          "This method expects an ArrayBufferView as a first argument.");
+      return;
+    }
+    Local<ArrayBufferView> view = info[0].As<ArrayBufferView>();
+    std::vector<uint8_t> bytes(view->ByteLength());
+    view->CopyContents(bytes.data(), bytes.size());
+    uint32_t sum = 0;
+    for (uint8_t byte : bytes) sum += byte;
+    info.GetReturnValue().Set(sum);
+  }
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAllFastCallbackPatch(AnyCType receiver,
                                           AnyCType arg_i32, AnyCType arg_u32,
@@ -1450,6 +1491,16 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
                               ConstructorBehavior::kThrow,
                               SideEffectType::kHasSideEffect, &copy_str_func));
 
+    CFunction sum_bytes_c_func = CFunction::Make(
+        FastCApiObject::SumBytesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::SumBytesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_bytes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumBytesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_bytes_c_func));
+
     CFunction add_all_c_func =
         CFunction::Make(FastCApiObject::AddAllFastCallback V8_IF_USE_SIMULATOR(
             FastCApiObject::AddAllFastCallbackPatch));
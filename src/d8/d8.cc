@@ -5784,7 +5784,11 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    // Messages are only read by workers of the same process, so they can use
+    // the more compact format.
+    serializer_.SetUseObjectShapes(true);
+  }
 
   Serializer(const Serializer&) = delete;
   Serializer& operator=(const Serializer&) = delete;
@@ -5859,6 +5863,25 @@ class Serializer : public ValueSerializer::Delegate {
     return Just<uint32_t>(static_cast<uint32_t>(index));
   }
 
+  bool WriteArrayBufferContents(Isolate* isolate, const void* data,
+                                size_t byte_length,
+                                uint32_t* contents_id) override {
+    DCHECK_NOT_NULL(data_);
+    current_memory_usage_ += byte_length;
+    if (current_memory_usage_ > Shell::options.max_serializer_memory) {
+      // The contents are then written to the buffer, which counts them again.
+      current_memory_usage_ -= byte_length;
+      return false;
+    }
+    std::unique_ptr<BackingStore> backing_store =
+        ArrayBuffer::NewBackingStore(isolate_, byte_length);
+    if (byte_length > 0) memcpy(backing_store->Data(), data, byte_length);
+    *contents_id =
+        static_cast<uint32_t>(data_->out_of_band_backing_stores_.size());
+    data_->out_of_band_backing_stores_.push_back(std::move(backing_store));
+    return true;
+  }
+
   void* ReallocateBufferMemory(void* old_buffer, size_t size,
                                size_t* actual_size) override {
     // Not accurate, because we don't take into account reallocated buffers,
@@ -6005,6 +6028,14 @@ class Deserializer : public ValueDeserializer::Delegate {
     return nullptr;
   }
 
+  MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+      Isolate* isolate, uint32_t contents_id) override {
+    DCHECK_NOT_NULL(data_);
+    if (contents_id >= data_->out_of_band_backing_stores().size()) return {};
+    return ArrayBuffer::New(
+        isolate_, data_->out_of_band_backing_stores().at(contents_id));
+  }
+
  private:
   Isolate* isolate_;
   ValueDeserializer deserializer_;
@@ -149,6 +149,10 @@ class SerializationData {
   const std::vector<std::shared_ptr<v8::BackingStore>>& sab_backing_stores() {
     return sab_backing_stores_;
   }
+  const std::vector<std::shared_ptr<v8::BackingStore>>&
+  out_of_band_backing_stores() {
+    return out_of_band_backing_stores_;
+  }
   const std::vector<CompiledWasmModule>& compiled_wasm_modules() {
     return compiled_wasm_modules_;
   }
@@ -165,6 +169,7 @@ class SerializationData {
   size_t size_ = 0;
   std::vector<std::shared_ptr<v8::BackingStore>> backing_stores_;
   std::vector<std::shared_ptr<v8::BackingStore>> sab_backing_stores_;
+  std::vector<std::shared_ptr<v8::BackingStore>> out_of_band_backing_stores_;
   std::vector<CompiledWasmModule> compiled_wasm_modules_;
   std::optional<v8::SharedValueConveyor> shared_value_conveyor_;
 
@@ -2114,6 +2114,8 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
   CHECK(IsSmi(TaggedField<Object>::load(*this, kCaptureCountOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kTicksUntilTierUpOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kBacktrackLimitOffset)));
+  CHECK(IsUndefined(required_literal()) || IsString(required_literal()));
+  CHECK(IsSmi(TaggedField<Object>::load(*this, kRequiredLiteralOffsetOffset)));
 
   switch (type_tag()) {
     case RegExpData::Type::EXPERIMENTAL: {
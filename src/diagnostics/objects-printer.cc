@@ -904,6 +904,8 @@ void IrRegExpData::IrRegExpDataPrint(std::ostream& os) {
   os << "\n - capture_count: " << max_register_count();
   os << "\n - ticks_until_tier_up: " << max_register_count();
   os << "\n - backtrack_limit: " << max_register_count();
+  os << "\n - required_literal: " << Brief(required_literal());
+  os << "\n - required_literal_offset: " << required_literal_offset();
   os << "\n";
 }
 
@@ -106,6 +106,7 @@
 #include "src/objects/waiter-queue-node.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
+#include "src/regexp/experimental/experimental-bit-parallel.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
@@ -4030,7 +4031,9 @@ Isolate::Isolate(IsolateGroup* isolate_group)
       next_unique_sfi_id_(0),
       next_module_async_evaluation_ordinal_(
           SourceTextModule::kFirstAsyncEvaluationOrdinal),
-      cancelable_task_manager_(new CancelableTaskManager()) {
+      cancelable_task_manager_(new CancelableTaskManager()),
+      atomics_synchronization_statistics_(
+          new JSSynchronizationPrimitiveStatistics()) {
   TRACE_ISOLATE(constructor);
   CheckIsolateLayout();
 
@@ -4502,6 +4505,9 @@ Isolate::~Isolate() {
   delete regexp_stack_;
   regexp_stack_ = nullptr;
 
+  delete regexp_bit_parallel_nfa_cache_;
+  regexp_bit_parallel_nfa_cache_ = nullptr;
+
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
@@ -5140,6 +5146,44 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int MaxParallelism() override {
+    if (!v8_flags.parallel_bigint) return 1;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
+  }
+
+  void RunInParallel(int count,
+                     const std::function<void(int)>& task) override {
+    class BigIntJob final : public JobTask {
+     public:
+      BigIntJob(int count, const std::function<void(int)>& task)
+          : count_(count), task_(task) {}
+
+      void Run(JobDelegate* delegate) override {
+        do {
+          int index = next_index_.fetch_add(1, std::memory_order_relaxed);
+          if (index >= count_) return;
+          task_(index);
+        } while (!delegate->ShouldYield());
+      }
+
+      size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+        int next_index = next_index_.load(std::memory_order_relaxed);
+        return std::max(0, count_ - next_index);
+      }
+
+     private:
+      const int count_;
+      const std::function<void(int)>& task_;
+      std::atomic<int> next_index_{0};
+    };
+    // The calling thread participates in {Join}, which only returns once all
+    // tasks have finished.
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BigIntJob>(count, task))
+        ->Join();
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -5322,6 +5366,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
+  regexp_bit_parallel_nfa_cache_ = new ExperimentalRegExpBitParallelNfaCache();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
   interpreter_ = new interpreter::Interpreter(this);
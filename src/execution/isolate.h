@@ -124,6 +124,7 @@ class Debug;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
+class ExperimentalRegExpBitParallelNfaCache;
 class EternalHandles;
 class GlobalHandles;
 class GlobalSafepoint;
@@ -199,6 +200,8 @@ namespace detail {
 class WaiterQueueNode;
 }  // namespace detail
 
+struct JSSynchronizationPrimitiveStatistics;
+
 #define RETURN_FAILURE_IF_EXCEPTION(isolate)         \
   do {                                               \
     Isolate* __isolate__ = (isolate);                \
@@ -1407,6 +1410,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() const { return regexp_stack_; }
 
+  ExperimentalRegExpBitParallelNfaCache* regexp_bit_parallel_nfa_cache() const {
+    return regexp_bit_parallel_nfa_cache_;
+  }
+
   size_t total_regexp_code_generated() const {
     return total_regexp_code_generated_;
   }
@@ -2249,6 +2256,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::list<std::unique_ptr<detail::WaiterQueueNode>>&
   async_waiter_queue_nodes();
 
+  JSSynchronizationPrimitiveStatistics* atomics_synchronization_statistics() {
+    return atomics_synchronization_statistics_.get();
+  }
+
   void ReportExceptionFunctionCallback(
       DirectHandle<JSReceiver> receiver,
       DirectHandle<FunctionTemplateInfo> function,
@@ -2452,6 +2463,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  ExperimentalRegExpBitParallelNfaCache* regexp_bit_parallel_nfa_cache_ =
+      nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
@@ -2721,6 +2734,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // waiters for JSSynchronizationPrimitives.
   std::list<std::unique_ptr<detail::WaiterQueueNode>> async_waiter_queue_nodes_;
 
+  std::unique_ptr<JSSynchronizationPrimitiveStatistics>
+      atomics_synchronization_statistics_;
+
   // Used to track and safepoint all client isolates attached to this shared
   // isolate.
   std::unique_ptr<GlobalSafepoint> global_safepoint_;
@@ -1009,6 +1009,16 @@ DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "--short-builtin-calls are also enabled")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
+DEFINE_BOOL(baseline_batch_compilation_adaptive, false,
+            "size concurrent Sparkplug batches from the measured compile "
+            "throughput and install delay instead of using a fixed threshold")
+DEFINE_INT(baseline_batch_compilation_min_threshold, 1 * KB,
+           "the smallest batch size used by adaptive batch compilation")
+DEFINE_INT(baseline_batch_compilation_max_threshold, 64 * KB,
+           "the largest batch size used by adaptive batch compilation")
+DEFINE_FLOAT(baseline_batch_compilation_target_ms, 1.0,
+             "the background compile time that adaptive batch compilation "
+             "aims for, per batch")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
 DEFINE_BOOL(trace_baseline_batch_compilation, false,
             "trace baseline batch compilation")
@@ -1029,6 +1039,17 @@ DEFINE_EXPERIMENTAL_FEATURE(
 // forwarding table.
 DEFINE_NEG_IMPLICATION(shared_string_table, always_use_string_forwarding_table)
 
+// Atomics.Mutex and Atomics.Condition
+DEFINE_BOOL(js_atomics_mutex_adaptive_spinning, true,
+            "adapt the number of spins before a contended Atomics.Mutex "
+            "goes to sleep to the spins that recent acquisitions needed")
+DEFINE_INT(js_atomics_mutex_max_spins, 1024,
+           "maximum number of CPU pauses spent spinning on a contended "
+           "Atomics.Mutex with --js-atomics-mutex-adaptive-spinning")
+DEFINE_BOOL(js_atomics_mutex_handoff, false,
+            "hand a contended Atomics.Mutex directly to the longest "
+            "sleeping waiter on unlock, instead of letting threads race for it")
+
 DEFINE_BOOL(transition_strings_during_gc_with_stack, false,
             "Transition strings during a full GC with stack")
 
@@ -1382,6 +1403,11 @@ DEFINE_WEAK_IMPLICATION(future, turboshaft_wasm)
 DEFINE_BOOL(turboshaft_wasm_load_elimination, false,
             "enable Turboshaft's WasmLoadElimination")
 DEFINE_WEAK_IMPLICATION(turboshaft_wasm, turboshaft_wasm_load_elimination)
+DEFINE_BOOL(turboshaft_wasm_bounds_check_elimination, false,
+            "enable Turboshaft's elimination of explicit wasm memory bounds "
+            "checks")
+DEFINE_WEAK_IMPLICATION(turboshaft_wasm,
+                        turboshaft_wasm_bounds_check_elimination)
 
 DEFINE_BOOL(turboshaft_instruction_selection, true,
             "run instruction selection on Turboshaft IR directly")
@@ -1391,6 +1417,15 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_loop_unswitching, false,
+            "enable Turboshaft's loop unswitching and partial redundancy "
+            "elimination")
+DEFINE_INT(turboshaft_loop_unswitching_max_size, 200,
+           "maximum number of operations of a loop that can be unswitched "
+           "(unswitching duplicates the whole loop)")
+DEFINE_INT(turboshaft_loop_unswitching_budget, 1000,
+           "maximum total number of operations that loop unswitching can add "
+           "to a function")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1422,6 +1457,7 @@ DEFINE_EXPERIMENTAL_FEATURE(
     "enable Turboshaft features that we want to ship in the not-too-far future")
 DEFINE_IMPLICATION(turboshaft_future, turboshaft)
 DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_wasm)
+DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_loop_unswitching)
 #if V8_TARGET_ARCH_X64 or V8_TARGET_ARCH_ARM64 or V8_TARGET_ARCH_ARM or \
     V8_TARGET_ARCH_IA32
 DEFINE_WEAK_IMPLICATION(turboshaft_future,
@@ -1575,6 +1611,9 @@ DEFINE_INT(
     wasm_caching_timeout_ms, 2000,
     "only trigger caching if no new code was compiled within this timeout (0 "
     "to disable this logic and only use --wasm-caching-threshold)")
+DEFINE_BOOL(wasm_serialize_liftoff_code, false,
+            "also serialize Liftoff code, so that deserialized modules do not "
+            "need to recompile functions that were not tiered up yet")
 DEFINE_BOOL(trace_wasm_compilation_times, false,
             "print how long it took to compile each wasm function")
 DEFINE_INT(wasm_tier_up_filter, -1, "only tier-up function with this index")
@@ -1981,6 +2020,10 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "threshold for starting incremental marking immediately in percent "
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_BOOL(numa_aware_heap, false,
+            "allocate heap pages on the NUMA node of the thread that owns "
+            "them, and hint the platform to run marking and scavenging "
+            "workers on the node of the isolate")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(minor_gc_task, true, "schedule scavenge tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
@@ -2034,6 +2077,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_SIZE_T(zone_segment_pool_size, 4 * MB,
+              "maximum number of bytes of free zone segments that are kept "
+              "for reuse by all threads, 0 disables the zone segment pool")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -2093,6 +2139,9 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0,
+             "Bound the time that compaction adds to a full GC pause, "
+             "leaving further fragmented pages to later GCs (0 for no bound)")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -2202,6 +2251,18 @@ DEFINE_FLOAT(memory_balancer_c_value, 3e-10,
              "The smaller the more memory it uses.")
 DEFINE_NEG_IMPLICATION(memory_balancer, memory_reducer)
 DEFINE_BOOL(trace_memory_balancer, false, "print memory balancer behavior.")
+DEFINE_BOOL(predictive_heap_controller, false,
+            "set the old generation allocation limit from forecasts of the "
+            "allocation rate and of the live size")
+DEFINE_FLOAT(predictive_heap_controller_gc_cpu_share, 0.03,
+             "share of the CPU time that the predictive heap controller lets "
+             "mark-compacts take")
+DEFINE_SIZE_T(predictive_heap_controller_memory_limit, 0,
+              "highest old generation allocation limit in MB that the "
+              "predictive heap controller sets, or 0 for none")
+DEFINE_NEG_IMPLICATION(predictive_heap_controller, memory_balancer)
+DEFINE_BOOL(trace_predictive_heap_controller, false,
+            "print the decisions of the predictive heap controller")
 
 // assembler-ia32.cc / assembler-arm.cc / assembler-arm64.cc / assembler-x64.cc
 #ifdef V8_ENABLE_DEBUG_CODE
@@ -2529,6 +2590,14 @@ DEFINE_BOOL(allow_natives_for_differential_fuzzing, false,
 DEFINE_IMPLICATION(allow_natives_for_differential_fuzzing, allow_natives_syntax)
 DEFINE_IMPLICATION(allow_natives_for_differential_fuzzing, fuzzing)
 DEFINE_BOOL(parse_only, false, "only parse the sources")
+DEFINE_BOOL(parallel_preparse, false,
+            "preparse top-level function declarations on background threads")
+DEFINE_INT(parallel_preparse_min_function_size, 1024,
+           "minimum size in characters of the functions that are preparsed "
+           "on background threads")
+DEFINE_BOOL(parallel_preparse_join_for_testing, false,
+            "wait for all functions to be preparsed on background threads "
+            "before parsing the script")
 
 // simulator-arm.cc and simulator-arm64.cc.
 #ifdef USE_SIMULATOR
@@ -2667,6 +2736,9 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
            "tiering-up to the compiler")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_BOOL(regexp_required_literal_prefilter, true,
+            "before running irregexp code on a long subject, search the "
+            "subject for a literal that every match contains")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2689,6 +2761,17 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_bit_parallel, false,
+            "rule out non-matching subjects with a bit-parallel simulation "
+            "of small NFAs in the experimental regexp engine, if the lazy DFA "
+            "is disabled or gives up")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "find the first match with a lazily built DFA before running the "
+            "experimental regexp engine's interpreter")
+DEFINE_UINT64(experimental_regexp_engine_lazy_dfa_max_memory_usage, 8,
+              "maximum memory usage in MB of the lazy DFA of the experimental "
+              "engine, which also counts towards "
+              "experimental_regexp_engine_capture_group_opt_max_memory_usage")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3183,6 +3266,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3209,14 +3293,19 @@ DEFINE_NEG_IMPLICATION(predictable_gc_schedule, memory_reducer)
 // Threading related flags.
 //
 
+DEFINE_BOOL(parallel_bigint, true,
+            "use background threads for operations on huge BigInts")
+
 DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
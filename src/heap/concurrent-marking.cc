@@ -183,6 +183,10 @@ class ConcurrentMarking::JobTaskMajor : public v8::JobTask {
     return concurrent_marking_->GetMajorMaxConcurrency(worker_count);
   }
 
+  int GetNumaNodeHint() const override {
+    return concurrent_marking_->heap_->numa_node();
+  }
+
   uint64_t trace_id() const { return trace_id_; }
 
  private:
@@ -231,6 +235,10 @@ class ConcurrentMarking::JobTaskMinor : public v8::JobTask {
     return concurrent_marking_->GetMinorMaxConcurrency(worker_count);
   }
 
+  int GetNumaNodeHint() const override {
+    return concurrent_marking_->heap_->numa_node();
+  }
+
   uint64_t trace_id() const { return trace_id_; }
 
  private:
@@ -4142,6 +4142,8 @@ Handle<RegExpData> Factory::NewIrRegExpData(DirectHandle<String> source,
                                 : JSRegExp::kUninitializedValue;
   instance->set_ticks_until_tier_up(ticks_until_tier_up);
   instance->set_backtrack_limit(backtrack_limit);
+  instance->set_required_literal(read_only_roots().undefined_value());
+  instance->set_required_literal_offset(-1);
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
   raw_wrapper->set_data(instance);
@@ -4176,6 +4178,8 @@ Handle<RegExpData> Factory::NewExperimentalRegExpData(
   instance->set_capture_count(capture_count);
   instance->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
   instance->set_backtrack_limit(JSRegExp::kUninitializedValue);
+  instance->set_required_literal(read_only_roots().undefined_value());
+  instance->set_required_literal_offset(-1);
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
   raw_wrapper->set_data(instance);
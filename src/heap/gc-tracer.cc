@@ -408,6 +408,7 @@ void GCTracer::UpdateMemoryBalancerGCSpeed() {
   {
     base::MutexGuard guard(&background_scopes_mutex_);
     concurrent_gc_time =
+        background_scopes_[Scope::MC_BACKGROUND_CLEAR_WEAK_COLLECTIONS] +
         background_scopes_[Scope::MC_BACKGROUND_EVACUATE_COPY] +
         background_scopes_[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS] +
         background_scopes_[Scope::MC_BACKGROUND_MARKING] +
@@ -697,6 +698,12 @@ void GCTracer::AddCompactionEvent(double duration,
       live_bytes_compacted, base::TimeDelta::FromMillisecondsD(duration)));
 }
 
+void GCTracer::AddCompactionPauseEvent(base::TimeDelta duration,
+                                       size_t live_bytes_compacted) {
+  recorded_compaction_pauses_.Push(
+      BytesAndDuration(live_bytes_compacted, duration));
+}
+
 void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
@@ -1275,6 +1282,10 @@ double GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return BoundedAverageSpeed(recorded_compactions_);
 }
 
+double GCTracer::CompactionPauseSpeedInBytesPerMillisecond() const {
+  return BoundedAverageSpeed(recorded_compaction_pauses_);
+}
+
 double GCTracer::MarkCompactSpeedInBytesPerMillisecond() const {
   return BoundedAverageSpeed(recorded_mark_compacts_);
 }
@@ -1444,6 +1455,7 @@ void GCTracer::RecordGCSumCounters() {
   {
     base::MutexGuard guard(&background_scopes_mutex_);
     background_duration =
+        background_scopes_[Scope::MC_BACKGROUND_CLEAR_WEAK_COLLECTIONS] +
         background_scopes_[Scope::MC_BACKGROUND_EVACUATE_COPY] +
         background_scopes_[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS] +
         background_scopes_[Scope::MC_BACKGROUND_MARKING] +
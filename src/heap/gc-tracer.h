@@ -335,6 +335,12 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddCompactionEvent(double duration, size_t live_bytes_compacted);
 
+  // Log the time that the atomic pause of a full GC spent evacuating pages and
+  // updating pointers, given that it compacted `live_bytes_compacted` bytes of
+  // old generation pages.
+  void AddCompactionPauseEvent(base::TimeDelta duration,
+                               size_t live_bytes_compacted);
+
   void AddSurvivalRatio(double survival_ratio);
 
   void SampleConcurrencyEsimate(size_t concurrency);
@@ -366,6 +372,11 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns 0 if not enough events have been recorded.
   double CompactionSpeedInBytesPerMillisecond() const;
 
+  // Compute the average speed at which the atomic pause compacts old
+  // generation pages, including updating pointers, in bytes/millisecond.
+  // Returns 0 if no events have been recorded.
+  double CompactionPauseSpeedInBytesPerMillisecond() const;
+
   // Compute the average mark-sweep speed in bytes/millisecond.
   // Returns 0 if no events have been recorded.
   double MarkCompactSpeedInBytesPerMillisecond() const;
@@ -560,6 +571,7 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   BytesAndDurationBuffer recorded_minor_gcs_total_;
   BytesAndDurationBuffer recorded_compactions_;
+  BytesAndDurationBuffer recorded_compaction_pauses_;
   BytesAndDurationBuffer recorded_incremental_mark_compacts_;
   BytesAndDurationBuffer recorded_mark_compacts_;
   BytesAndDurationBuffer recorded_new_generation_allocations_;
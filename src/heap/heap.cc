@@ -84,6 +84,7 @@
 #include "src/heap/objects-visiting.h"
 #include "src/heap/paged-spaces-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/predictive-heap-controller.h"
 #include "src/heap/pretenuring-handler.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
@@ -110,6 +111,7 @@
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
 #include "src/profiler/heap-profiler.h"
+#include "src/regexp/experimental/experimental-bit-parallel.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -120,6 +122,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/zone-segment-pool.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -2592,7 +2595,11 @@ void Heap::RecomputeLimits(GarbageCollector collector, base::TimeTicks time) {
       mb_->RecomputeLimits(new_limits.global_allocation_limit -
                                new_limits.old_generation_allocation_limit,
                            time);
-    } else {
+    } else if (!predictive_heap_controller_ ||
+               !predictive_heap_controller_->RecomputeLimits(
+                   new_limits.global_allocation_limit -
+                       new_limits.old_generation_allocation_limit,
+                   time)) {
       SetOldGenerationAndGlobalAllocationLimit(
           new_limits.old_generation_allocation_limit,
           new_limits.global_allocation_limit);
@@ -2729,6 +2736,7 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->regexp_bit_parallel_nfa_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -4162,6 +4170,7 @@ void Heap::CheckMemoryPressure() {
       MemoryPressureLevel::kNone, std::memory_order_relaxed);
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
+    ZoneSegmentPool::Get()->ReleaseMemory();
     CollectGarbageOnMemoryPressure();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (v8_flags.incremental_marking && incremental_marking()->IsStopped()) {
@@ -5554,6 +5563,10 @@ void Heap::SetUp(LocalHeap* main_thread_local_heap) {
   // Set the stack start for the main thread that sets up the heap.
   SetStackStart();
 
+  if (v8_flags.numa_aware_heap && base::OS::GetNumaNodeCount() > 1) {
+    numa_node_ = base::OS::GetCurrentNumaNode();
+  }
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   heap_allocator_->UpdateAllocationTimeout();
 #endif  // V8_ENABLE_ALLOCATION_TIMEOUT
@@ -5887,6 +5900,17 @@ void Heap::SetUpSpaces(LinearAllocationArea& new_allocation_info,
   if (v8_flags.memory_balancer) {
     mb_.reset(new MemoryBalancer(this, startup_time));
   }
+  if (v8_flags.predictive_heap_controller) {
+    const size_t min_headroom =
+        MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+            HeapGrowingMode::kDefault);
+    predictive_heap_controller_ = std::make_unique<PredictiveHeapController>(
+        this,
+        PredictiveHeapController::Config{
+            v8_flags.predictive_heap_controller_gc_cpu_share,
+            v8_flags.predictive_heap_controller_memory_limit * MB,
+            min_headroom, V8HeapTrait::kMaxGrowingFactor});
+  }
 }
 
 void Heap::InitializeHashSeed() {
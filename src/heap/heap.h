@@ -23,6 +23,7 @@
 #include "src/base/enum-set.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/small-vector.h"
 #include "src/builtins/accessors.h"
 #include "src/common/assert-scope.h"
@@ -111,6 +112,7 @@ class ObjectStats;
 class PageMetadata;
 class PagedSpace;
 class PagedNewSpace;
+class PredictiveHeapController;
 class ReadOnlyHeap;
 class RootVisitor;
 class RwxMemoryWriteScope;
@@ -676,6 +678,10 @@ class Heap final {
   // Returns true when GC should optimize for battery.
   V8_EXPORT_PRIVATE bool ShouldOptimizeForBattery() const;
 
+  // The NUMA node of the thread that set up the heap with --numa-aware-heap,
+  // or base::OS::kAnyNumaNode.
+  int numa_node() const { return numa_node_; }
+
   bool HighMemoryPressure() {
     return memory_pressure_level_.load(std::memory_order_relaxed) !=
            v8::MemoryPressureLevel::kNone;
@@ -2384,6 +2390,8 @@ class Heap final {
 
   bool deserialization_complete_ = false;
 
+  int numa_node_ = base::OS::kAnyNumaNode;
+
   int max_regular_code_object_size_ = 0;
 
   bool inline_allocation_enabled_ = true;
@@ -2408,6 +2416,7 @@ class Heap final {
   ResizeNewSpaceMode resize_new_space_mode_ = ResizeNewSpaceMode::kNone;
 
   std::unique_ptr<MemoryBalancer> mb_;
+  std::unique_ptr<PredictiveHeapController> predictive_heap_controller_;
 
   std::atomic<double> load_start_time_ms_{0};
   bool update_allocation_limits_after_loading_ = false;
@@ -2451,6 +2460,7 @@ class Heap final {
   friend class ObjectStatsCollector;
   friend class PageMetadata;
   friend class PagedNewSpaceAllocatorPolicy;
+  friend class PredictiveHeapController;
   friend class PagedSpaceAllocatorPolicy;
   friend class PagedSpaceBase;
   friend class PagedSpaceForNewSpace;
@@ -546,6 +546,22 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
   }
+
+  // Unless memory should be reduced, keep evacuation and pointer updating
+  // within the pause budget, shared by all compacted spaces. The most
+  // fragmented pages are selected first, and the rest are left to later GCs.
+  if (v8_flags.compaction_pause_budget_ms > 0 && !heap_->ShouldReduceMemory()) {
+    const double compaction_pause_speed =
+        heap_->tracer()->CompactionPauseSpeedInBytesPerMillisecond();
+    if (compaction_pause_speed != 0) {
+      size_t budget_bytes = static_cast<size_t>(
+          v8_flags.compaction_pause_budget_ms * compaction_pause_speed);
+      for (PageMetadata* p : evacuation_candidates_) {
+        budget_bytes -= std::min(budget_bytes, p->allocated_bytes());
+      }
+      *max_evacuated_bytes = std::min(*max_evacuated_bytes, budget_bytes);
+    }
+  }
 }
 
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
@@ -2844,6 +2860,84 @@ class MarkCompactCollector::FilterNonTrivialWeakRefJobItem final
   const uint64_t trace_id_;
 };
 
+class MarkCompactCollector::ClearWeakCollectionsJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearWeakCollectionsJobItem(MarkCompactCollector* collector)
+      : collector_(collector),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  collector->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS)) {}
+
+  void Run(JobDelegate* delegate) final {
+    Heap* heap = collector_->heap();
+
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(heap->isolate());
+
+    // Several items can run at the same time, so the ones on background
+    // threads have to use a background scope.
+    if (delegate->IsJoiningThread()) {
+      TRACE_GC_WITH_FLOW(heap->tracer(),
+                         GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS, trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_IN);
+      ClearWeakCollections();
+    } else {
+      TRACE_GC_EPOCH_WITH_FLOW(
+          heap->tracer(), GCTracer::Scope::MC_BACKGROUND_CLEAR_WEAK_COLLECTIONS,
+          ThreadKind::kBackground, trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+      ClearWeakCollections();
+    }
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  void ClearWeakCollections() {
+    WeakObjects::WeakObjectWorklist<Tagged<EphemeronHashTable>>::Local
+        ephemeron_hash_tables(
+            collector_->weak_objects()->ephemeron_hash_tables);
+    collector_->ClearWeakCollections(&ephemeron_hash_tables);
+  }
+
+  MarkCompactCollector* collector_;
+  const uint64_t trace_id_;
+};
+
+class MarkCompactCollector::ClearJSWeakRefsJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearJSWeakRefsJobItem(MarkCompactCollector* collector)
+      : collector_(collector),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  collector->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES)) {}
+
+  void Run(JobDelegate* delegate) final {
+    Heap* heap = collector_->heap();
+
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(heap->isolate());
+
+    TRACE_GC1_WITH_FLOW(heap->tracer(),
+                        GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    WeakObjects::WeakObjectWorklist<Tagged<JSWeakRef>>::Local js_weak_refs(
+        collector_->weak_objects()->js_weak_refs);
+    collector_->ClearJSWeakRefs(&js_weak_refs);
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  MarkCompactCollector* collector_;
+  const uint64_t trace_id_;
+};
+
 void MarkCompactCollector::ClearNonLiveReferences() {
   TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR);
 
@@ -2969,6 +3063,12 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   // before proceeding to the actual clearing of non-trivial weak references,
   // whereas the job for clearing trivial weak references can be joined at the
   // end of this method.
+  // A third job clears dead entries of weak collections and the targets of
+  // JSWeakRefs, for the same reasons it cannot start any earlier. It runs
+  // alongside the main thread clearing non-trivial weak references and
+  // WeakCells, which touch neither, and is joined at the end of this method.
+  // The weak collections are split across up to one item per core, each of
+  // which steals segments of weak maps from the global worklist.
   std::unique_ptr<JobHandle> clear_trivial_weakrefs_job_handle;
   {
     auto job = std::make_unique<ParallelClearingJob>(this);
@@ -2992,9 +3092,34 @@ void MarkCompactCollector::ClearNonLiveReferences() {
         V8::GetCurrentPlatform()->CreateJob(TaskPriority::kUserBlocking,
                                             std::move(job));
   }
+  std::unique_ptr<JobHandle> clear_weak_collections_job_handle;
+  {
+    auto job = std::make_unique<ParallelClearingJob>(this);
+    local_weak_objects()->ephemeron_hash_tables_local.Publish();
+    local_weak_objects()->js_weak_refs_local.Publish();
+    const size_t weak_collections_items =
+        std::min(weak_objects_.ephemeron_hash_tables.Size(),
+                 static_cast<size_t>(NumberOfAvailableCores()));
+    for (size_t i = 0; i < weak_collections_items; ++i) {
+      auto weak_collections_item =
+          std::make_unique<ClearWeakCollectionsJobItem>(this);
+      const uint64_t trace_id = weak_collections_item->trace_id();
+      job->Add(std::move(weak_collections_item));
+      TRACE_GC_NOTE_WITH_FLOW("ClearWeakCollectionsJob started", trace_id,
+                              TRACE_EVENT_FLAG_FLOW_OUT);
+    }
+    auto js_weak_refs_item = std::make_unique<ClearJSWeakRefsJobItem>(this);
+    const uint64_t js_weak_refs_trace_id = js_weak_refs_item->trace_id();
+    job->Add(std::move(js_weak_refs_item));
+    TRACE_GC_NOTE_WITH_FLOW("ClearJSWeakRefsJob started",
+                            js_weak_refs_trace_id, TRACE_EVENT_FLAG_FLOW_OUT);
+    clear_weak_collections_job_handle = V8::GetCurrentPlatform()->CreateJob(
+        TaskPriority::kUserBlocking, std::move(job));
+  }
   if (v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()) {
     clear_trivial_weakrefs_job_handle->NotifyConcurrencyIncrease();
     filter_non_trivial_weakrefs_job_handle->NotifyConcurrencyIncrease();
+    clear_weak_collections_job_handle->NotifyConcurrencyIncrease();
   }
 
 #ifdef V8_COMPRESS_POINTERS
@@ -3051,8 +3176,8 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_WEAKNESS_HANDLING);
     ClearNonTrivialWeakReferences();
-    ClearWeakCollections();
-    ClearJSWeakRefs();
+    ClearEphemeronRememberedSet();
+    ClearWeakCells();
   }
 
   PROFILE(heap_->isolate(), WeakCodeClearEvent());
@@ -3072,6 +3197,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
     clear_string_table_job_handle->Join();
     clear_trivial_weakrefs_job_handle->Join();
+    clear_weak_collections_job_handle->Join();
   }
 
   if (v8_flags.sticky_mark_bits) {
@@ -3687,10 +3813,11 @@ void MarkCompactCollector::TrimEnumCache(Tagged<Map> map,
   heap_->RightTrimArray(indices, live_enum, indices_length);
 }
 
-void MarkCompactCollector::ClearWeakCollections() {
-  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+void MarkCompactCollector::ClearWeakCollections(
+    WeakObjects::WeakObjectWorklist<Tagged<EphemeronHashTable>>::Local*
+        ephemeron_hash_tables) {
   Tagged<EphemeronHashTable> table;
-  while (local_weak_objects()->ephemeron_hash_tables_local.Pop(&table)) {
+  while (ephemeron_hash_tables->Pop(&table)) {
     for (InternalIndex i : table->IterateEntries()) {
       Tagged<HeapObject> key = Cast<HeapObject>(table->KeyAt(i));
 #ifdef VERIFY_HEAP
@@ -3711,10 +3838,14 @@ void MarkCompactCollector::ClearWeakCollections() {
       if (MarkingHelper::GetLivenessMode(heap_, key) ==
               MarkingHelper::LivenessMode::kMarkbit &&
           !non_atomic_marking_state_->IsMarked(key)) {
+        // Only writes read-only holes, so no write barrier is needed.
         table->RemoveEntry(i);
       }
     }
   }
+}
+
+void MarkCompactCollector::ClearEphemeronRememberedSet() {
   auto* table_map = heap_->ephemeron_remembered_set()->tables();
   for (auto it = table_map->begin(); it != table_map->end();) {
     if (!non_atomic_marking_state_->IsMarked(it->first)) {
@@ -3802,21 +3933,27 @@ void MarkCompactCollector::ClearNonTrivialWeakReferences() {
   }
 }
 
-void MarkCompactCollector::ClearJSWeakRefs() {
-  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES);
+void MarkCompactCollector::ClearJSWeakRefs(
+    WeakObjects::WeakObjectWorklist<Tagged<JSWeakRef>>::Local* js_weak_refs) {
   Tagged<JSWeakRef> weak_ref;
-  Isolate* const isolate = heap_->isolate();
-  while (local_weak_objects()->js_weak_refs_local.Pop(&weak_ref)) {
+  Tagged<Undefined> undefined =
+      ReadOnlyRoots(heap_->isolate()).undefined_value();
+  while (js_weak_refs->Pop(&weak_ref)) {
     Tagged<HeapObject> target = Cast<HeapObject>(weak_ref->target());
     if (!InReadOnlySpace(target) &&
         !non_atomic_marking_state_->IsMarked(target)) {
-      weak_ref->set_target(ReadOnlyRoots(isolate).undefined_value());
+      // Undefined is read-only, so no write barrier is needed.
+      weak_ref->set_target(undefined, SKIP_WRITE_BARRIER);
     } else {
       // The value of the JSWeakRef is alive.
       ObjectSlot slot = weak_ref->RawField(JSWeakRef::kTargetOffset);
       RecordSlot(weak_ref, slot, target);
     }
   }
+}
+
+void MarkCompactCollector::ClearWeakCells() {
+  Isolate* const isolate = heap_->isolate();
   Tagged<WeakCell> weak_cell;
   while (local_weak_objects()->weak_cells_local.Pop(&weak_cell)) {
     auto gc_notify_updated_slot = [](Tagged<HeapObject> object, ObjectSlot slot,
@@ -4699,10 +4836,11 @@ void TraceEvacuation(Isolate* isolate, size_t pages_count,
 
 }  // namespace
 
-void MarkCompactCollector::EvacuatePagesInParallel() {
+size_t MarkCompactCollector::EvacuatePagesInParallel() {
   std::vector<std::pair<ParallelWorkItem, MutablePageMetadata*>>
       evacuation_items;
   intptr_t live_bytes = 0;
+  size_t old_generation_live_bytes = 0;
 
   // Evacuation of new space pages cannot be aborted, so it needs to run
   // before old space evacuation.
@@ -4766,6 +4904,7 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     if (chunk->IsFlagSet(MemoryChunk::COMPACTION_WAS_ABORTED)) continue;
 
     live_bytes += page->live_bytes();
+    old_generation_live_bytes += page->live_bytes();
     evacuation_items.emplace_back(ParallelWorkItem{}, page);
   }
 
@@ -4802,6 +4941,7 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     TraceEvacuation(heap_->isolate(), pages_count, wanted_num_tasks, live_bytes,
                     aborted_pages);
   }
+  return old_generation_live_bytes;
 }
 
 class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
@@ -4827,13 +4967,23 @@ void MarkCompactCollector::Evacuate() {
     EvacuatePrologue();
   }
 
+  const base::TimeTicks evacuation_start = base::TimeTicks::Now();
+  size_t compacted_bytes;
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_EVACUATE_COPY);
-    EvacuatePagesInParallel();
+    compacted_bytes = EvacuatePagesInParallel();
   }
 
   UpdatePointersAfterEvacuation();
 
+  // The measured time includes evacuating the young generation and updating
+  // pointers from it, which makes the speed err on the side of shorter pauses.
+  // Live bytes are counted before evacuation, which clears them.
+  if (compacted_bytes > 0) {
+    heap_->tracer()->AddCompactionPauseEvent(
+        base::TimeTicks::Now() - evacuation_start, compacted_bytes);
+  }
+
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_EVACUATE_CLEAN_UP);
 
@@ -323,8 +323,15 @@ class MarkCompactCollector final {
 
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
-  // The linked list of all encountered weak maps is destroyed.
-  void ClearWeakCollections();
+  // This is performed in a parallel job, whose items each pop the weak maps
+  // through their own view of the worklist.
+  void ClearWeakCollections(
+      WeakObjects::WeakObjectWorklist<Tagged<EphemeronHashTable>>::Local*
+          ephemeron_hash_tables);
+  class ClearWeakCollectionsJobItem;
+
+  // Drops the weak maps that are not live from the ephemeron remembered set.
+  void ClearEphemeronRememberedSet();
 
   // Goes through the list of encountered trivial weak references and clears
   // those with dead values. This is performed in a parallel job. In short, a
@@ -345,9 +352,16 @@ class MarkCompactCollector final {
   // transition.
   void ClearNonTrivialWeakReferences();
 
-  // Goes through the list of encountered JSWeakRefs and WeakCells and clears
-  // those with dead values.
-  void ClearJSWeakRefs();
+  // Goes through the list of encountered JSWeakRefs and clears those with
+  // dead targets. This is performed in a parallel job, whose item pops the
+  // JSWeakRefs through its own view of the worklist.
+  void ClearJSWeakRefs(
+      WeakObjects::WeakObjectWorklist<Tagged<JSWeakRef>>::Local* js_weak_refs);
+  class ClearJSWeakRefsJobItem;
+
+  // Goes through the list of encountered WeakCells and clears those with dead
+  // targets, scheduling their FinalizationRegistries for cleanup.
+  void ClearWeakCells();
 
   // Starts sweeping of spaces by contributing on the main thread and setting
   // up other pages for sweeping. Does not start sweeper tasks.
@@ -357,7 +371,8 @@ class MarkCompactCollector final {
   void EvacuatePrologue();
   void EvacuateEpilogue();
   void Evacuate();
-  void EvacuatePagesInParallel();
+  // Returns the live bytes of the old generation pages that are evacuated.
+  size_t EvacuatePagesInParallel();
   void UpdatePointersAfterEvacuation();
 
   void ReleaseEvacuationCandidates();
@@ -15,6 +15,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/local-heap.h"
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/read-only-spaces.h"
@@ -163,6 +164,19 @@ Address MemoryAllocator::AllocateAlignedMemory(
 
   Address base = reservation.address();
 
+  if (const int numa_node = isolate_->heap()->numa_node();
+      numa_node != base::OS::kAnyNumaNode) {
+    // Fault the pages in on the node of the thread that owns them, which is
+    // the isolate's main thread unless a background thread allocates them for
+    // its LocalHeap.
+    LocalHeap* local_heap = LocalHeap::Current();
+    base::OS::SetNumaNodeForMemory(
+        reinterpret_cast<void*>(base), chunk_size,
+        local_heap && !local_heap->is_main_thread()
+            ? base::OS::GetCurrentNumaNode()
+            : numa_node);
+  }
+
   if (executable == EXECUTABLE) {
     ThreadIsolation::RegisterJitPage(base, chunk_size);
   }
@@ -0,0 +1,201 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/predictive-heap-controller.h"
+
+#include <algorithm>
+
+#include "include/v8-metrics.h"
+#include "src/execution/isolate.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/heap-inl.h"
+#include "src/logging/metrics.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
+
+namespace v8 {
+namespace internal {
+
+void PredictiveHeapController::Forecast::Add(double value, double elapsed_ms) {
+  if (!has_value_) {
+    level_ = value;
+    trend_ = 0;
+    has_value_ = true;
+    return;
+  }
+  // Back-to-back samples would blow up the trend.
+  constexpr double kMinElapsedMs = 1;
+  elapsed_ms = std::max(elapsed_ms, kMinElapsedMs);
+  const double level = level_weight_ * value +
+                       (1 - level_weight_) * (level_ + trend_ * elapsed_ms);
+  trend_ = trend_weight_ * (level - level_) / elapsed_ms +
+           (1 - trend_weight_) * trend_;
+  level_ = level;
+}
+
+PredictiveHeapController::PredictiveHeapController(Heap* heap,
+                                                   const Config& config)
+    : heap_(heap), config_(config) {
+  DCHECK_LT(0, config_.gc_cpu_share);
+  DCHECK_LT(config_.gc_cpu_share, 1);
+  DCHECK_LT(1, config_.max_growing_factor);
+}
+
+// static
+const char* PredictiveHeapController::BoundToString(Bound bound) {
+  switch (bound) {
+    case Bound::kGCCpuShare:
+      return "gc-cpu-share";
+    case Bound::kMinimumHeadroom:
+      return "minimum-headroom";
+    case Bound::kMaxGrowingFactor:
+      return "max-growing-factor";
+    case Bound::kMemoryLimit:
+      return "memory-limit";
+    case Bound::kHeapSize:
+      return "heap-size";
+  }
+  UNREACHABLE();
+}
+
+std::optional<PredictiveHeapController::Decision>
+PredictiveHeapController::Update(size_t live_bytes, double allocation_rate,
+                                 double gc_speed, base::TimeTicks time) {
+  const double elapsed_ms =
+      last_update_ ? (time - *last_update_).InMillisecondsF() : 0;
+  last_update_ = time;
+  const double live = static_cast<double>(live_bytes);
+  live_bytes_.Add(live, elapsed_ms);
+  if (allocation_rate > 0) allocation_rate_.Add(allocation_rate, elapsed_ms);
+  if (!allocation_rate_.has_value() || gc_speed <= 0) return {};
+
+  // The next cycle is assumed to last about as long as the last one.
+  const double rate = std::max(allocation_rate_.Predict(elapsed_ms), 0.0);
+  const double trend = std::max(live_bytes_.trend(), 0.0);
+  const double share = config_.gc_cpu_share;
+
+  // A mark-compact of L live bytes takes L / gc_speed, and must be preceded by
+  // (1 - share) / share as much mutator time, during which `rate` fills the
+  // headroom H. The live size grows by `trend` per millisecond meanwhile, so
+  //   H = rate * (1 - share) / share * (L + trend * H / rate) / gc_speed.
+  const double headroom_per_live_byte = rate * (1 - share) / share / gc_speed;
+  const double trend_share = std::min((1 - share) / share * trend / gc_speed,
+                                      kMaxTrendShareOfHeadroom);
+  const double headroom = headroom_per_live_byte * live / (1 - trend_share);
+
+  double limit = live + headroom;
+  Bound bound = Bound::kGCCpuShare;
+  const double max_limit = live * config_.max_growing_factor;
+  if (limit > max_limit) {
+    limit = max_limit;
+    bound = Bound::kMaxGrowingFactor;
+  }
+  const double min_limit = live + static_cast<double>(config_.min_headroom);
+  if (limit < min_limit) {
+    limit = min_limit;
+    bound = Bound::kMinimumHeadroom;
+  }
+  const double min_heap_size =
+      static_cast<double>(heap_->min_old_generation_size());
+  if (limit < min_heap_size) {
+    limit = min_heap_size;
+    bound = Bound::kHeapSize;
+  }
+  // See the class comment for the order of the remaining bounds.
+  const double memory_limit =
+      std::max(static_cast<double>(config_.memory_limit), min_limit);
+  if (config_.memory_limit > 0 && limit > memory_limit) {
+    limit = memory_limit;
+    bound = Bound::kMemoryLimit;
+  }
+  const double max_heap_size =
+      static_cast<double>(heap_->max_old_generation_size());
+  if (limit > max_heap_size) {
+    limit = max_heap_size;
+    bound = Bound::kHeapSize;
+  }
+
+  const double predicted_live =
+      rate > 0 ? live + trend * std::max(limit - live, 0.0) / rate : live;
+  return Decision{live_bytes,
+                  static_cast<size_t>(predicted_live),
+                  static_cast<size_t>(limit),
+                  bound,
+                  rate,
+                  live_bytes_.trend(),
+                  gc_speed};
+}
+
+bool PredictiveHeapController::RecomputeLimits(
+    size_t embedder_allocation_limit, base::TimeTicks time) {
+  std::optional<Decision> decision = Update(
+      heap_->OldGenerationConsumedBytes(),
+      heap_->tracer()
+          ->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond(),
+      heap_->tracer()->CombinedMarkCompactSpeedInBytesPerMillisecond(), time);
+  // Memory pressure and low memory call for the default, conservative limits.
+  if (!decision ||
+      heap_->CurrentHeapGrowingMode() != Heap::HeapGrowingMode::kDefault) {
+    return false;
+  }
+
+  Report(*decision);
+  heap_->SetOldGenerationAndGlobalAllocationLimit(
+      decision->limit, decision->limit + embedder_allocation_limit);
+  return true;
+}
+
+void PredictiveHeapController::Report(const Decision& decision) {
+  Isolate* isolate = heap_->isolate();
+  if (v8_flags.trace_predictive_heap_controller) {
+    if (config_.memory_limit > 0 && decision.limit > config_.memory_limit) {
+      isolate->PrintWithTimestamp(
+          "PredictiveHeapController: memory limit of %.1fMB is infeasible at "
+          "live=%.1fMB\n",
+          static_cast<double>(config_.memory_limit) / MB,
+          static_cast<double>(decision.live_bytes) / MB);
+    }
+    isolate->PrintWithTimestamp(
+        "PredictiveHeapController: live=%.1fMB predicted-live=%.1fMB "
+        "allocation-rate=%.1fKB/ms live-trend=%.1fKB/ms gc-speed=%.1fKB/ms "
+        "limit=%.1fMB bound=%s\n",
+        static_cast<double>(decision.live_bytes) / MB,
+        static_cast<double>(decision.predicted_live_bytes) / MB,
+        decision.allocation_rate / KB, decision.live_bytes_trend / KB,
+        decision.gc_speed / KB, static_cast<double>(decision.limit) / MB,
+        BoundToString(decision.bound));
+  }
+
+  auto value = tracing::TracedValue::Create();
+  value->SetDouble("live_bytes", static_cast<double>(decision.live_bytes));
+  value->SetDouble("predicted_live_bytes",
+                   static_cast<double>(decision.predicted_live_bytes));
+  value->SetDouble("limit", static_cast<double>(decision.limit));
+  value->SetDouble("allocation_rate", decision.allocation_rate);
+  value->SetDouble("live_bytes_trend", decision.live_bytes_trend);
+  value->SetDouble("gc_speed", decision.gc_speed);
+  value->SetString("bound", BoundToString(decision.bound));
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                       "V8.GC_PredictiveHeapController",
+                       TRACE_EVENT_SCOPE_THREAD, "decision", std::move(value));
+
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  v8::metrics::GarbageCollectionLimitDecision event;
+  event.live_bytes = static_cast<int64_t>(decision.live_bytes);
+  event.predicted_live_bytes =
+      static_cast<int64_t>(decision.predicted_live_bytes);
+  event.allocation_limit_bytes = static_cast<int64_t>(decision.limit);
+  event.allocation_rate_in_bytes_per_ms = decision.allocation_rate;
+  event.live_bytes_trend_in_bytes_per_ms = decision.live_bytes_trend;
+  event.gc_speed_in_bytes_per_ms = decision.gc_speed;
+  event.bound = static_cast<int>(decision.bound);
+  // This runs during the atomic pause, where contexts can't be looked up.
+  recorder->DelayMainThreadEvent(event,
+                                 v8::metrics::Recorder::ContextId::Empty());
+}
+
+}  // namespace internal
+}  // namespace v8
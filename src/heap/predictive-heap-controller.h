@@ -0,0 +1,134 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PREDICTIVE_HEAP_CONTROLLER_H_
+#define V8_HEAP_PREDICTIVE_HEAP_CONTROLLER_H_
+
+#include <optional>
+
+#include "src/base/platform/time.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Sets the old generation allocation limit after each mark-compact from
+// forecasts of the allocation rate and of the live size, instead of from the
+// last measurements alone.
+//
+// Both quantities are smoothed with Holt's linear method, which tracks a level
+// and a trend, so that a short burst of allocations moves the forecast only
+// part of the way, and a live size that keeps growing is anticipated rather
+// than discovered one mark-compact at a time. The limit leaves as much
+// headroom above the live size as the forecast allocation rate needs to keep
+// the time spent in mark-compacts at the targeted share of the CPU time,
+// assuming that a mark-compact takes time proportional to the live size at
+// its start.
+//
+// The limit is then kept within the heap's old generation size bounds and an
+// optional memory limit. The memory limit goes before the heap's minimum old
+// generation size, but not before the minimum headroom, since a limit at or
+// below the live size would have every allocation trigger a mark-compact. The
+// heap's maximum old generation size goes before everything.
+class V8_EXPORT_PRIVATE PredictiveHeapController final {
+ public:
+  // What bounds a limit.
+  enum class Bound {
+    kGCCpuShare,
+    kMinimumHeadroom,
+    kMaxGrowingFactor,
+    kMemoryLimit,
+    kHeapSize,
+  };
+
+  struct Config {
+    // The share of the CPU time spent in mark-compacts to aim for.
+    double gc_cpu_share;
+    // The highest limit to set, or 0 for no limit.
+    size_t memory_limit;
+    // The least headroom to leave above the live size, unless that would
+    // exceed the heap's maximum old generation size.
+    size_t min_headroom;
+    // The highest ratio of limit to live size.
+    double max_growing_factor;
+  };
+
+  struct Decision {
+    size_t live_bytes;
+    size_t predicted_live_bytes;
+    size_t limit;
+    Bound bound;
+    // Forecasts, in bytes per millisecond.
+    double allocation_rate;
+    double live_bytes_trend;
+    double gc_speed;
+  };
+
+  PredictiveHeapController(Heap* heap, const Config& config);
+
+  PredictiveHeapController(const PredictiveHeapController&) = delete;
+  PredictiveHeapController& operator=(const PredictiveHeapController&) = delete;
+
+  // Sets the allocation limits of the heap after a mark-compact, keeping
+  // `embedder_allocation_limit` bytes for the embedder in the global limit.
+  // Returns false and leaves the limits alone if the tracer hasn't measured
+  // the allocation rate and mark-compact speed yet, or if the heap should grow
+  // more conservatively than usual.
+  bool RecomputeLimits(size_t embedder_allocation_limit, base::TimeTicks time);
+
+  // Adds the measurements at the end of a mark-compact to the forecasts and
+  // computes the next limit. `allocation_rate` and `gc_speed` are in bytes per
+  // millisecond. Returns nothing if there is no measurement of either yet.
+  std::optional<Decision> Update(size_t live_bytes, double allocation_rate,
+                                 double gc_speed, base::TimeTicks time);
+
+  static const char* BoundToString(Bound bound);
+
+ private:
+  // Holt's linear exponential smoothing of samples that arrive at irregular
+  // intervals. The trend is per millisecond.
+  class Forecast final {
+   public:
+    Forecast(double level_weight, double trend_weight)
+        : level_weight_(level_weight), trend_weight_(trend_weight) {}
+
+    void Add(double value, double elapsed_ms);
+
+    bool has_value() const { return has_value_; }
+    double level() const { return level_; }
+    double trend() const { return trend_; }
+    double Predict(double elapsed_ms) const {
+      return level_ + trend_ * elapsed_ms;
+    }
+
+   private:
+    const double level_weight_;
+    const double trend_weight_;
+    bool has_value_ = false;
+    double level_ = 0;
+    double trend_ = 0;
+  };
+
+  // The weights that new samples get.
+  static constexpr double kLevelWeight = 0.3;
+  static constexpr double kTrendWeight = 0.2;
+
+  // The live size trend may eat up at most this much of the headroom.
+  static constexpr double kMaxTrendShareOfHeadroom = 0.9;
+
+  void Report(const Decision& decision);
+
+  Heap* const heap_;
+  const Config config_;
+  Forecast allocation_rate_{kLevelWeight, kTrendWeight};
+  Forecast live_bytes_{kLevelWeight, kTrendWeight};
+  std::optional<base::TimeTicks> last_update_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PREDICTIVE_HEAP_CONTROLLER_H_
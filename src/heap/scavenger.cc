@@ -273,6 +273,10 @@ size_t ScavengerCollector::JobTask::GetMaxConcurrency(
   return std::min<size_t>(scavengers_->size(), wanted_num_workers);
 }
 
+int ScavengerCollector::JobTask::GetNumaNodeHint() const {
+  return outer_->heap_->numa_node();
+}
+
 void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
                                                Scavenger* scavenger) {
   double scavenging_time = 0.0;
@@ -268,6 +268,7 @@ class ScavengerCollector {
 
     void Run(JobDelegate* delegate) override;
     size_t GetMaxConcurrency(size_t worker_count) const override;
+    int GetNumaNodeHint() const override;
 
     uint64_t trace_id() const { return trace_id_; }
 
@@ -743,6 +743,7 @@
   F(BACKGROUND_COLLECTION)                  \
   F(BACKGROUND_UNPARK)                      \
   F(BACKGROUND_SAFEPOINT)                   \
+  F(MC_BACKGROUND_CLEAR_WEAK_COLLECTIONS)   \
   F(MC_BACKGROUND_EVACUATE_COPY)            \
   F(MC_BACKGROUND_EVACUATE_UPDATE_POINTERS) \
   F(MC_BACKGROUND_MARKING)                  \
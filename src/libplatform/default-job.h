@@ -12,6 +12,7 @@
 #include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 
 namespace v8 {
 namespace platform {
@@ -140,6 +141,9 @@ class DefaultJobWorker : public Task {
     auto shared_state = state_.lock();
     if (!shared_state) return;
     if (!shared_state->CanRunFirstTask()) return;
+    // Move to the NUMA node that the job prefers while running it.
+    base::CurrentThreadNumaNodeScope numa_node_scope(
+        job_task_->GetNumaNodeHint());
     do {
       // Scope of |delegate| must not outlive DidRunTask() so that associated
       // state is freed before the worker becomes inactive.
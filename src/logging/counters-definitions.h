@@ -115,6 +115,8 @@ namespace internal {
   HR(external_pointer_table_compaction_outcome,                                \
      V8.ExternalPointerTableCompactionOutcome, 0, 2, 3)                        \
   HR(wasm_compilation_method, V8.WasmCompilationMethod, 0, 4, 5)               \
+  /* Number of functions in a concurrently compiled Sparkplug batch. */        \
+  HR(baseline_batch_size, V8.SparkplugBatchSize, 1, 1000, 50)                  \
   HR(asmjs_instantiate_result, V8.AsmjsInstantiateResult, 0, 1, 2)
 
 #if V8_ENABLE_DRUMBRAKE
@@ -318,6 +320,11 @@ namespace internal {
      V8.CompileScriptMicroSeconds.BackgroundThread, 1000000, MICROSECOND)      \
   HT(compile_function_on_background,                                           \
      V8.CompileFunctionMicroSeconds.BackgroundThread, 1000000, MICROSECOND)    \
+  /* Time from enqueuing a Sparkplug batch to having installed its code. */    \
+  HT(baseline_batch_latency, V8.SparkplugBatchLatencyMicroSeconds, 10000000,   \
+     MICROSECOND)                                                              \
+  HT(baseline_batch_install_time, V8.SparkplugBatchInstallMicroSeconds,        \
+     1000000, MICROSECOND)                                                     \
   HT(deserialize_script_on_background,                                         \
      V8.CompileScriptMicroSeconds.ConsumeCache.BackgroundThread, 1000000,      \
      MICROSECOND)                                                              \
@@ -362,6 +369,11 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  /* Instantiations of object templates that copied a cached instance, */      \
+  /* that created and cached one, and that couldn't use the cache. */          \
+  SC(template_instantiation_cache_hits, V8.TemplateInstantiationCacheHits)     \
+  SC(template_instantiation_cache_misses, V8.TemplateInstantiationCacheMisses) \
+  SC(template_instantiations_uncached, V8.TemplateInstantiationsUncached)      \
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
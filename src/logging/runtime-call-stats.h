@@ -138,6 +138,7 @@ class RuntimeCallTimer final {
   V(ArrayBuffer_NewBackingStore)                           \
   V(ArrayBuffer_BackingStore_Reallocate)                   \
   V(Array_CloneElementAt)                                  \
+  V(Array_GetElements)                                     \
   V(Array_Iterate)                                         \
   V(Array_New)                                             \
   V(BigInt64Array_New)                                     \
@@ -204,6 +205,7 @@ class RuntimeCallTimer final {
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMultiple)                                    \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -394,6 +396,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLateOptimization)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopPeeling)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnrolling)           \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnswitching)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMachineLowering)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMaglevGraphBuilding)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftOptimize)                \
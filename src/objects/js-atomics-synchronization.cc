@@ -4,6 +4,8 @@
 
 #include "src/objects/js-atomics-synchronization.h"
 
+#include <algorithm>
+
 #include "src/base/macros.h"
 #include "src/base/platform/yield-processor.h"
 #include "src/execution/isolate-inl.h"
@@ -106,6 +108,8 @@ Global<T> GetWeakGlobal(Isolate* isolate, Local<T> object) {
   return global;
 }
 
+std::atomic<void (*)()> timed_out_waiter_hook_for_testing{nullptr};
+
 }  // namespace
 
 namespace detail {
@@ -172,6 +176,7 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
 
   void Wait() {
     AllowGarbageCollection allow_before_parking;
+    ParkTimer park_timer(requester_);
     requester_->main_thread_local_heap()->ExecuteWhileParked([this]() {
       base::MutexGuard guard(&wait_lock_);
       while (should_wait_) {
@@ -184,6 +189,7 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
   bool WaitFor(const base::TimeDelta& rel_time) {
     bool result;
     AllowGarbageCollection allow_before_parking;
+    ParkTimer park_timer(requester_);
     requester_->main_thread_local_heap()->ExecuteWhileParked([this, rel_time,
                                                               &result]() {
       base::MutexGuard guard(&wait_lock_);
@@ -194,8 +200,15 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
           result = true;
           return;
         }
+        if (handed_off_) {
+          // The mutex was handed to this waiter, which is about to be
+          // notified, so it can no longer time out.
+          wait_cond_var_.Wait(&wait_lock_);
+          continue;
+        }
         current_time = base::TimeTicks::Now();
         if (current_time >= timeout_time) {
+          timed_out_ = true;
           result = false;
           return;
         }
@@ -215,6 +228,25 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
     SetNotInListForVerification();
   }
 
+  bool AcceptHandoff() override {
+    // Whether the waiter timed out or was handed the mutex is decided under
+    // the wait lock, so a waiter that timed out is never handed the mutex.
+    base::MutexGuard guard(&wait_lock_);
+    if (timed_out_) return false;
+    handed_off_ = true;
+    return true;
+  }
+
+  bool HasTimedOut() override {
+    base::MutexGuard guard(&wait_lock_);
+    return timed_out_;
+  }
+
+  // Whether the mutex that this node was waiting for is now held on behalf of
+  // the waiter. Only meaningful after waking up, or with the waiter queue lock
+  // held.
+  bool handed_off() const { return handed_off_; }
+
   bool IsSameIsolateForAsyncCleanup(Isolate* isolate) override {
     // Sync waiters are only queued while the thread is sleeping, so there
     // should not be sync nodes while cleaning up the isolate.
@@ -229,9 +261,29 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
  private:
   void SetReadyForAsyncCleanup() override { UNREACHABLE(); }
 
+  // Records the number of times and the time that the thread spends parked.
+  class V8_NODISCARD ParkTimer {
+   public:
+    explicit ParkTimer(Isolate* isolate)
+        : stats_(isolate->atomics_synchronization_statistics()),
+          start_(base::TimeTicks::Now()) {}
+    ~ParkTimer() {
+      JSSynchronizationPrimitiveStatistics::Increment(&stats_->park_count);
+      JSSynchronizationPrimitiveStatistics::Increment(
+          &stats_->park_time_in_us,
+          (base::TimeTicks::Now() - start_).InMicroseconds());
+    }
+
+   private:
+    JSSynchronizationPrimitiveStatistics* stats_;
+    base::TimeTicks start_;
+  };
+
   base::Mutex wait_lock_;
   base::ConditionVariable wait_cond_var_;
   bool should_wait_;
+  bool handed_off_ = false;
+  bool timed_out_ = false;
 };
 
 template <typename T>
@@ -594,11 +646,30 @@ bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
   constexpr int kSpinCount = 64;
   constexpr int kMaxBackoff = 16;
 
+  using Stats = JSSynchronizationPrimitiveStatistics;
+  Stats* stats = requester->atomics_synchronization_statistics();
+  Stats::Increment(&stats->contended_lock_count);
+
+  // With adaptive spinning, the spin limit follows the number of spins that
+  // recent contended acquisitions needed, so that short critical sections are
+  // waited out without sleeping while long ones don't waste CPU time.
+  int spin_limit = kSpinCount;
+  if (v8_flags.js_atomics_mutex_adaptive_spinning) {
+    int max_spins =
+        std::max(Stats::kMinSpins, v8_flags.js_atomics_mutex_max_spins.value());
+    spin_limit =
+        std::clamp(2 * stats->spin_estimate, Stats::kMinSpins, max_spins);
+  }
+
   int tries = 0;
   int backoff = 1;
+  bool locked = false;
   StateT current_state = state->load(std::memory_order_relaxed);
   do {
-    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) return true;
+    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) {
+      locked = true;
+      break;
+    }
 
     for (int yields = 0; yields < backoff; yields++) {
       YIELD_PROCESSOR;
@@ -606,8 +677,16 @@ bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
     }
 
     backoff = std::min(kMaxBackoff, backoff << 1);
-  } while (tries < kSpinCount);
-  return false;
+  } while (tries < spin_limit);
+
+  Stats::Increment(&stats->spin_count, tries);
+  if (locked) {
+    Stats::Increment(&stats->spin_acquire_count);
+    stats->spin_estimate += (tries - stats->spin_estimate) / 8;
+  } else {
+    stats->spin_estimate -= stats->spin_estimate / 4;
+  }
+  return locked;
 }
 
 bool JSAtomicsMutex::MaybeEnqueueNode(Isolate* requester,
@@ -661,6 +740,8 @@ std::optional<WaiterQueueLockGuard> JSAtomicsMutex::LockWaiterQueueOrJSMutex(
 bool JSAtomicsMutex::LockJSMutexOrDequeueTimedOutWaiter(
     Isolate* requester, std::atomic<StateT>* state,
     WaiterQueueNode* timed_out_waiter) {
+  // A waiter that timed out is never handed the js mutex lock.
+  DCHECK(timed_out_waiter->HasTimedOut());
   // First acquire the queue lock, which is itself a spinlock.
   StateT current_state = state->load(std::memory_order_relaxed);
   // There are no waiters, but the js mutex lock may be held by another thread.
@@ -694,11 +775,11 @@ bool JSAtomicsMutex::LockJSMutexOrDequeueTimedOutWaiter(
 
   if (!dequeued_node) {
     // The timed out waiter was not in the queue, so it must have been dequeued
-    // and notified between the time this thread woke up and the time it
-    // acquired the queue lock, so there is a risk that the next queue head is
-    // never notified. Try to take the js mutex lock here, if we succeed, the
-    // next node will be notified by this thread, otherwise, it will be notified
-    // by the thread holding the lock now.
+    // and notified, or skipped by a handoff, between the time this thread woke
+    // up and the time it acquired the queue lock, so there is a risk that the
+    // next queue head is never notified. Try to take the js mutex lock here,
+    // if we succeed, the next node will be notified by this thread, otherwise,
+    // it will be notified by the thread holding the lock now.
 
     // Since we use strong CAS below, we know that the js mutex lock will be
     // held by either this thread or another thread that can't go through the
@@ -750,6 +831,10 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
       // blocked.
       state = mutex->AtomicStatePtr();
       if (!rv) {
+        if (auto hook = timed_out_waiter_hook_for_testing.load(
+                std::memory_order_relaxed)) {
+          hook();
+        }
         // If timed out, remove ourself from the waiter list, which is usually
         // done by the thread performing the notifying.
         rv = mutex->LockJSMutexOrDequeueTimedOutWaiter(requester, state,
@@ -763,12 +848,20 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
       state = mutex->AtomicStatePtr();
     }
 
+    // In handoff mode, the unlocking thread kept the lock held for us.
+    if (this_waiter.handed_off()) return true;
+
     // After wake up we try to acquire the lock again by spinning, as the
     // contention at the point of going to sleep should not be correlated with
     // contention at the point of waking up.
   }
 }
 
+// static
+void JSAtomicsMutex::SetTimedOutWaiterHookForTesting(void (*hook)()) {
+  timed_out_waiter_hook_for_testing.store(hook, std::memory_order_relaxed);
+}
+
 void JSAtomicsMutex::UnlockSlowPath(Isolate* requester,
                                     std::atomic<StateT>* state) {
   // The fast path unconditionally cleared the owner thread.
@@ -792,13 +885,32 @@ void JSAtomicsMutex::UnlockSlowPath(Isolate* requester,
   DCHECK_NOT_NULL(waiter_head);
   WaiterQueueNode* old_head = WaiterQueueNode::Dequeue(&waiter_head);
 
-  // Release both the lock and the queue lock, and install the new waiter queue
-  // head.
-  StateT new_state = IsLockedField::update(current_state, false);
+  // In handoff mode, the lock is passed directly to a sleeping waiter instead
+  // of being released, which keeps spinning threads from repeatedly barging in
+  // ahead of it. Waiters that timed out but haven't dequeued themselves yet
+  // are skipped; they find themselves dequeued and report the timeout.
+  bool handoff = false;
+  if (v8_flags.js_atomics_mutex_handoff) {
+    while (!(handoff = old_head->AcceptHandoff()) && old_head->HasTimedOut()) {
+      if (waiter_head == nullptr) {
+        old_head = nullptr;
+        break;
+      }
+      old_head = WaiterQueueNode::Dequeue(&waiter_head);
+    }
+  }
+  if (handoff) {
+    JSSynchronizationPrimitiveStatistics::Increment(
+        &requester->atomics_synchronization_statistics()->handoff_count);
+  }
+
+  // Release the queue lock and, unless it was handed off, the lock, and
+  // install the new waiter queue head.
+  StateT new_state = IsLockedField::update(current_state, handoff);
   new_state = SetWaiterQueueHead(requester, waiter_head, new_state);
   waiter_queue_lock_guard.set_new_state(new_state);
 
-  old_head->Notify();
+  if (old_head != nullptr) old_head->Notify();
 }
 
 // The lockAsync flow is controlled by a series of promises:
@@ -1164,6 +1276,10 @@ bool JSAtomicsCondition::WaitFor(Isolate* requester,
     if (timeout) {
       rv = this_waiter.WaitFor(*timeout);
       if (!rv) {
+        if (auto hook = timed_out_waiter_hook_for_testing.load(
+                std::memory_order_relaxed)) {
+          hook();
+        }
         // If timed out, remove ourself from the waiter list, which is usually
         // done by the thread performing the notifying.
         std::atomic<StateT>* state = cv->AtomicStatePtr();
@@ -35,6 +35,36 @@ using LockAsyncWaiterQueueNode = detail::AsyncWaiterQueueNode<JSAtomicsMutex>;
 using WaitAsyncWaiterQueueNode =
     detail::AsyncWaiterQueueNode<JSAtomicsCondition>;
 
+// Contention statistics of the JSAtomicsMutex and JSAtomicsCondition objects
+// used by an isolate, exposed through
+// v8::Isolate::GetAtomicsSynchronizationStatistics. Only the isolate's thread
+// updates them, but they may be read from any thread.
+struct JSSynchronizationPrimitiveStatistics {
+  static void Increment(std::atomic<uint64_t>* counter, uint64_t delta = 1) {
+    counter->store(counter->load(std::memory_order_relaxed) + delta,
+                   std::memory_order_relaxed);
+  }
+
+  // Lock attempts that found the mutex held by another thread.
+  std::atomic<uint64_t> contended_lock_count{0};
+  // CPU pauses executed while spinning on a contended mutex.
+  std::atomic<uint64_t> spin_count{0};
+  // Contended lock attempts that succeeded while spinning.
+  std::atomic<uint64_t> spin_acquire_count{0};
+  // Times the thread went to sleep waiting for a mutex or condition.
+  std::atomic<uint64_t> park_count{0};
+  std::atomic<uint64_t> park_time_in_us{0};
+  // Times a mutex was handed directly to a sleeping waiter on unlock.
+  std::atomic<uint64_t> handoff_count{0};
+
+  // The running average of the number of spins that contended lock attempts
+  // needed, which bounds how long the next attempt spins before sleeping. Only
+  // accessed from the isolate's thread.
+  int spin_estimate = kInitialSpinEstimate;
+  static constexpr int kInitialSpinEstimate = 32;
+  static constexpr int kMinSpins = 16;
+};
+
 // JSSynchronizationPrimitive is the base class for JSAtomicsMutex and
 // JSAtomicsCondition. It contains a 32-bit state field and a pointer to a
 // waiter queue head, used to manage the queue of waiting threads for both: the
@@ -262,6 +292,11 @@ class JSAtomicsMutex
   inline bool IsHeld();
   inline bool IsCurrentThreadOwner();
 
+  // Sets a function that waiters that timed out call before they dequeue
+  // themselves, so that tests can act while they are still queued.
+  V8_EXPORT_PRIVATE static void SetTimedOutWaiterHookForTesting(
+      void (*hook)());
+
   void UnlockAsyncLockedMutex(
       Isolate* requester, DirectHandle<Foreign> async_locked_waiter_wrapper);
 
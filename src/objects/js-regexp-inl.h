@@ -153,6 +153,10 @@ SMI_ACCESSORS(IrRegExpData, max_register_count, kMaxRegisterCountOffset)
 SMI_ACCESSORS(IrRegExpData, capture_count, kCaptureCountOffset)
 SMI_ACCESSORS(IrRegExpData, ticks_until_tier_up, kTicksUntilTierUpOffset)
 SMI_ACCESSORS(IrRegExpData, backtrack_limit, kBacktrackLimitOffset)
+ACCESSORS(IrRegExpData, required_literal, Tagged<Object>,
+          kRequiredLiteralOffset)
+SMI_ACCESSORS(IrRegExpData, required_literal_offset,
+              kRequiredLiteralOffsetOffset)
 
 }  // namespace internal
 }  // namespace v8
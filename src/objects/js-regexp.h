@@ -258,6 +258,11 @@ class IrRegExpData : public RegExpData {
   DECL_INT_ACCESSORS(capture_count)
   DECL_INT_ACCESSORS(ticks_until_tier_up)
   DECL_INT_ACCESSORS(backtrack_limit)
+  // A string that every match contains, or undefined, and its offset from the
+  // start of the match, or -1 if that varies or mustn't be used to skip ahead.
+  // See RegExp::SkipToRequiredLiteral.
+  DECL_ACCESSORS(required_literal, Tagged<Object>)
+  DECL_INT_ACCESSORS(required_literal_offset)
 
   bool CanTierUp();
   bool MarkedForTierUp();
@@ -286,6 +291,8 @@ class IrRegExpData : public RegExpData {
   V(kCaptureCountOffset, kTaggedSize)             \
   V(kTicksUntilTierUpOffset, kTaggedSize)         \
   V(kBacktrackLimitOffset, kTaggedSize)           \
+  V(kRequiredLiteralOffset, kTaggedSize)          \
+  V(kRequiredLiteralOffsetOffset, kTaggedSize)    \
   V(kHeaderSize, 0)                               \
   V(kSize, 0)
 
@@ -424,6 +424,7 @@ class IrRegExpData::BodyDescriptor final : public BodyDescriptorBase {
     IterateProtectedPointer(obj, kLatin1BytecodeOffset, v);
     IterateProtectedPointer(obj, kUc16BytecodeOffset, v);
     IteratePointer(obj, kCaptureNameMapOffset, v);
+    IteratePointer(obj, kRequiredLiteralOffset, v);
   }
 
   static inline int SizeOf(Tagged<Map> map, Tagged<HeapObject> obj) {
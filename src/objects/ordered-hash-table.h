@@ -211,6 +211,11 @@ class OrderedHashTable : public FixedArray {
                                             AllocationType allocation,
                                             RootIndex root_ndex);
 
+  // Moves the live entries into a new table of |new_capacity| in one go and
+  // marks |table| as obsolete. The rehash is not spread over later operations
+  // because the CSA builtins, TurboFan and Turboshaft inline lookups into the
+  // table, and iterators follow the chain of obsolete tables; all of them
+  // would have to probe two tables while a rehash is in progress.
   static MaybeHandle<Derived> Rehash(Isolate* isolate, Handle<Derived> table);
   static MaybeHandle<Derived> Rehash(Isolate* isolate, Handle<Derived> table,
                                      int new_capacity);
@@ -1242,6 +1242,98 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Visits the non-empty flat segments of a rope from left to right. In contrast
+// to ConsStringIterator, all pending right-hand sides are kept on the stack,
+// so left-leaning ropes built by repeated concatenation are visited in linear
+// time instead of being searched from the root again and again.
+class RopeSegmentIterator {
+ public:
+  explicit RopeSegmentIterator(Tagged<ConsString> rope) {
+    pending_.push_back(rope);
+  }
+
+  // Returns the next segment, or a null string at the end of the rope.
+  Tagged<String> Next() {
+    while (!pending_.empty()) {
+      Tagged<String> string = pending_.back();
+      pending_.pop_back();
+      while (IsConsString(string)) {
+        Tagged<ConsString> cons = Cast<ConsString>(string);
+        pending_.push_back(cons->second());
+        string = cons->first();
+      }
+      if (string->length() > 0) return string;
+    }
+    return {};
+  }
+
+ private:
+  std::vector<Tagged<String>> pending_;
+  DISALLOW_GARBAGE_COLLECTION(no_gc_)
+};
+
+void CopyFlatContent(base::uc16* dst, const String::FlatContent& content,
+                     int from, int count) {
+  if (content.IsOneByte()) {
+    CopyChars(dst, content.ToOneByteVector().begin() + from, count);
+  } else {
+    CopyChars(dst, content.ToUC16Vector().begin() + from, count);
+  }
+}
+
+// Finds the first occurrence of {pattern} in {rope} without flattening it.
+// Each segment is searched directly. Matches that span segment boundaries are
+// found by searching the last {pattern.length() - 1} characters before each
+// segment together with the first characters of the segment.
+template <typename PatternChar>
+int SearchRope(Isolate* isolate, Tagged<ConsString> rope,
+               base::Vector<const PatternChar> pattern,
+               const DisallowGarbageCollection& no_gc) {
+  DCHECK_LE(pattern.length(), String::kMaxRopeSearchPatternLength);
+  // Both searches build the same Boyer-Moore tables in the isolate, since
+  // these only depend on the pattern.
+  StringSearch<PatternChar, uint8_t> one_byte_search(isolate, pattern);
+  StringSearch<PatternChar, base::uc16> two_byte_search(isolate, pattern);
+  const int overlap = pattern.length() - 1;
+  // The characters carried over from previous segments, followed by the
+  // first characters of the current one.
+  base::SmallVector<base::uc16, 2 * String::kMaxRopeSearchPatternLength> window;
+  int position = 0;
+  RopeSegmentIterator segments(rope);
+  for (Tagged<String> segment = segments.Next(); !segment.is_null();
+       segment = segments.Next()) {
+    String::FlatContent content = segment->GetFlatContent(no_gc);
+    const int length = content.length();
+    const int carried = static_cast<int>(window.size());
+    const int prefix = std::min(overlap, length);
+    window.resize_no_init(carried + prefix);
+    CopyFlatContent(window.data() + carried, content, 0, prefix);
+    if (carried > 0 && carried + prefix > overlap) {
+      // Matches that start within the segment are found below.
+      int index = two_byte_search.Search(base::VectorOf(window), 0);
+      if (index != -1 && index < carried) return position - carried + index;
+    }
+    if (length > overlap) {
+      int index = content.IsOneByte()
+                      ? one_byte_search.Search(content.ToOneByteVector(), 0)
+                      : two_byte_search.Search(content.ToUC16Vector(), 0);
+      if (index != -1) return position + index;
+    }
+    position += length;
+    // Carry the last {overlap} characters over to the next segment.
+    if (length >= overlap) {
+      window.resize_no_init(overlap);
+      CopyFlatContent(window.data(), content, length - overlap, overlap);
+    } else if (static_cast<int>(window.size()) > overlap) {
+      // The whole segment has been appended to the window above.
+      const int excess = static_cast<int>(window.size()) - overlap;
+      std::copy(window.begin() + excess, window.end(), window.begin());
+      window.resize_no_init(overlap);
+    }
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1255,9 +1347,28 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
+  // Flattening a huge rope copies all of it, so searches from its beginning
+  // look at the segments directly. Searches from later positions are usually
+  // part of a loop over all matches, for which flattening once is cheaper
+  // than walking the rope every time. Keep this in sync with
+  // AbstractStringIndexOf in string.tq.
+  if (start_index == 0 &&
+      receiver_length >= static_cast<uint32_t>(kMinRopeSearchLength) &&
+      search_length <= static_cast<uint32_t>(kMaxRopeSearchPatternLength) &&
+      IsConsString(*receiver) && !receiver->IsFlat()) {
+    DisallowGarbageCollection no_gc;
+    Tagged<ConsString> rope = Cast<ConsString>(*receiver);
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    if (search_content.IsOneByte()) {
+      return SearchRope(isolate, rope, search_content.ToOneByteVector(), no_gc);
+    }
+    return SearchRope(isolate, rope, search_content.ToUC16Vector(), no_gc);
+  }
+
+  receiver = String::Flatten(isolate, receiver);
+
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent receiver_content = receiver->GetFlatContent(no_gc);
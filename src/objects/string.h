@@ -506,6 +506,11 @@ V8_OBJECT class String : public Name {
   // string length is used as the hash value.
   static const int kMaxHashCalcLength = 16383;
 
+  // Ropes of at least this length are searched segment by segment instead of
+  // being flattened, for patterns up to kMaxRopeSearchPatternLength.
+  static const int kMinRopeSearchLength = 1 << 16;
+  static const int kMaxRopeSearchPatternLength = 256;
+
   // Limit for truncation in short printing.
   static const int kMaxShortPrintLength = 1024;
 
@@ -100,6 +100,10 @@ using JSArrayBufferViewIsLengthTracking = base::BitField<bool, 0, 1>;
 using JSArrayBufferViewIsBackedByRab =
     JSArrayBufferViewIsLengthTracking::Next<bool, 1>;
 
+// Marks maps in ValueSerializer::object_shape_map_ whose objects are not
+// written as object shapes.
+constexpr uint32_t kNoObjectShape = std::numeric_limits<uint32_t>::max();
+
 }  // namespace
 
 template <typename T>
@@ -148,6 +152,14 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // Beginning of a JS object with a new object shape. numProperties:uint32_t,
+  // then |numProperties| keys, then |numProperties| values. The shape gets the
+  // next free shapeID (starting at 0). A value may be kTheHole if the
+  // property was deleted while serializing the object.
+  kBeginJSObjectWithNewShape = 'h',
+  // Beginning of a JS object with a previously written object shape.
+  // shapeID:uint32_t, then the values as for kBeginJSObjectWithNewShape.
+  kBeginJSObjectWithShape = 'j',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -186,6 +198,9 @@ enum class SerializationTag : uint8_t {
   kResizableArrayBuffer = '~',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer whose contents were copied out of band by the delegate.
+  // contentsID:uint32_t
+  kArrayBufferOutOfBand = 'O',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -293,7 +308,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {
+                                 ZoneAllocationPolicy(&zone_)),
+      object_shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {
   if (delegate_) {
     v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
     has_custom_host_objects_ = delegate_->HasCustomHostObject(v8_isolate);
@@ -319,6 +335,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetUseObjectShapes(bool mode) {
+  use_object_shapes_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -671,6 +691,15 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   DirectHandle<Map> map(object->map(), isolate_);
+  if (use_object_shapes_) {
+    auto find_result = object_shape_map_.FindOrInsert(*map);
+    if (!find_result.already_exists) {
+      *find_result.entry = IsObjectShapeCandidate(*map) ? 0 : kNoObjectShape;
+    }
+    if (*find_result.entry != kNoObjectShape) {
+      return WriteJSObjectWithShape(object, map, find_result.entry);
+    }
+  }
   WriteTag(SerializationTag::kBeginJSObject);
 
   // Write out fast properties as long as they are only data properties and the
@@ -712,6 +741,66 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+bool ValueSerializer::IsObjectShapeCandidate(Tagged<Map> map) {
+  // Only maps whose own properties are all enumerable data fields with string
+  // keys are written as shapes, so that their keys are exactly the properties
+  // that WriteJSObject would write.
+  if (map->NumberOfOwnDescriptors() == 0) return false;
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate_)) return false;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum() || details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Maybe<bool> ValueSerializer::WriteJSObjectWithShape(Handle<JSObject> object,
+                                                    DirectHandle<Map> map,
+                                                    uint32_t* shape_entry) {
+  if (*shape_entry != 0) {
+    WriteTag(SerializationTag::kBeginJSObjectWithShape);
+    WriteVarint<uint32_t>(*shape_entry - 1);
+  } else {
+    // |shape_entry| must not be used once we start writing the values, which
+    // can insert into |object_shape_map_| and trigger GCs.
+    *shape_entry = ++next_object_shape_id_;
+    WriteTag(SerializationTag::kBeginJSObjectWithNewShape);
+    WriteVarint<uint32_t>(map->NumberOfOwnDescriptors());
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      WriteString(handle(
+          Cast<String>(map->instance_descriptors(isolate_)->GetKey(i)),
+          isolate_));
+    }
+  }
+
+  // Write out the values in the order of the keys. If the map changes, this
+  // falls back to property lookups like WriteJSObject.
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    Handle<Object> value;
+    if (V8_LIKELY(*map == object->map())) {
+      PropertyDetails details =
+          map->instance_descriptors(isolate_)->GetDetails(i);
+      FieldIndex field_index = FieldIndex::ForDetails(*map, details);
+      value = handle(object->RawFastPropertyAt(field_index), isolate_);
+    } else {
+      Handle<Name> key(map->instance_descriptors(isolate_)->GetKey(i),
+                       isolate_);
+      LookupIterator it(isolate_, object, key, LookupIterator::OWN);
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
+      if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
+    }
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -994,6 +1083,18 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     WriteRawBytes(array_buffer->backing_store(), byte_length);
     return ThrowIfOutOfMemory();
   }
+  if (delegate_) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    uint32_t contents_id;
+    if (delegate_->WriteArrayBufferContents(
+            v8_isolate, array_buffer->backing_store(), byte_length,
+            &contents_id)) {
+      WriteTag(SerializationTag::kArrayBufferOutOfBand);
+      WriteVarint(contents_id);
+      return ThrowIfOutOfMemory();
+    }
+    RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -1281,6 +1382,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.end()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1290,11 +1393,14 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   DCHECK_LE(position_, end_);
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(object_shapes_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1610,6 +1716,10 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kBeginJSObjectWithNewShape:
+      return ReadJSObjectWithShape(true);
+    case SerializationTag::kBeginJSObjectWithShape:
+      return ReadJSObjectWithShape(false);
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1641,6 +1751,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferOutOfBand:
+      return ReadOutOfBandJSArrayBuffer();
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -1764,6 +1876,104 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   return scope.CloseAndEscape(object);
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadJSObjectWithShape(
+    bool is_new_shape) {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t shape_id;
+  if (is_new_shape) {
+    if (!ReadObjectShape().To(&shape_id)) return MaybeHandle<JSObject>();
+  } else if (!ReadVarint<uint32_t>().To(&shape_id) ||
+             shape_id >= num_object_shapes_) {
+    return MaybeHandle<JSObject>();
+  }
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  DirectHandle<FixedArray> keys(
+      Cast<FixedArray>(object_shapes_->get(2 * shape_id)), isolate_);
+  std::vector<Handle<Object>> values;
+  values.reserve(keys->length());
+  bool has_deleted_properties = false;
+  for (int i = 0; i < keys->length(); i++) {
+    SerializationTag tag;
+    if (!PeekTag().To(&tag)) return MaybeHandle<JSObject>();
+    if (tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      values.emplace_back();
+      has_deleted_properties = true;
+      continue;
+    }
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    values.push_back(value);
+  }
+
+  // Objects with the same shape usually end up with the same map, so try to
+  // reuse the map of the previous object, which avoids looking up transitions
+  // for every property.
+  if (!has_deleted_properties &&
+      TryCommitObjectShapeMap(object, shape_id, values)) {
+    DCHECK(HasObjectWithID(id));
+    return scope.CloseAndEscape(object);
+  }
+
+  for (int i = 0; i < keys->length(); i++) {
+    if (values[i].is_null()) continue;
+    PropertyKey lookup_key(isolate_, handle(keys->get(i), isolate_));
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, values[i], NONE)
+            .is_null()) {
+      return MaybeHandle<JSObject>();
+    }
+  }
+  if (!has_deleted_properties && !object->map()->is_dictionary_map() &&
+      object->map()->NumberOfOwnDescriptors() == keys->length()) {
+    object_shapes_->set(2 * shape_id + 1, object->map());
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
+Maybe<uint32_t> ValueDeserializer::ReadObjectShape() {
+  uint32_t num_properties;
+  // Each key takes at least one byte.
+  if (!ReadVarint<uint32_t>().To(&num_properties) ||
+      num_properties > static_cast<size_t>(end_ - position_) ||
+      num_properties > static_cast<uint32_t>(FixedArray::kMaxLength)) {
+    return Nothing<uint32_t>();
+  }
+  Handle<FixedArray> keys =
+      isolate_->factory()->NewFixedArray(static_cast<int>(num_properties));
+  for (uint32_t i = 0; i < num_properties; i++) {
+    Handle<Object> key;
+    if (!ReadObject().ToHandle(&key) || !IsString(*key, isolate_)) {
+      return Nothing<uint32_t>();
+    }
+    keys->set(static_cast<int>(i),
+              *isolate_->factory()->InternalizeString(Cast<String>(key)));
+  }
+
+  uint32_t shape_id = num_object_shapes_++;
+  Handle<FixedArray> new_array = FixedArray::SetAndGrow(
+      isolate_, object_shapes_, 2 * shape_id + 1,
+      isolate_->factory()->undefined_value());
+  new_array->set(2 * shape_id, *keys);
+  // If the array was reallocated, update the global handle.
+  if (!new_array.is_identical_to(object_shapes_)) {
+    GlobalHandles::Destroy(object_shapes_.location());
+    object_shapes_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return Just(shape_id);
+}
+
 MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSArray>());
@@ -2092,6 +2302,27 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  uint32_t contents_id;
+  Local<ArrayBuffer> array_buffer_value;
+  if (!ReadVarint<uint32_t>().To(&contents_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetArrayBufferFromContentsId(
+               reinterpret_cast<v8::Isolate*>(isolate_), contents_id)
+           .ToLocal(&array_buffer_value)) {
+    RETURN_EXCEPTION_IF_EXCEPTION(isolate_);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer = Utils::OpenHandle(*array_buffer_value);
+  if (array_buffer->is_shared() || array_buffer->is_resizable_by_js() ||
+      array_buffer->was_detached()) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     DirectHandle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
@@ -2424,6 +2655,46 @@ static bool IsValidObjectKey(Tagged<Object> value, Isolate* isolate) {
          InstanceTypeChecker::IsHeapNumber(instance_type);
 }
 
+bool ValueDeserializer::TryCommitObjectShapeMap(
+    Handle<JSObject> object, uint32_t shape_id,
+    const std::vector<Handle<Object>>& values) {
+  Tagged<Object> maybe_map = object_shapes_->get(2 * shape_id + 1);
+  if (!IsMap(maybe_map, isolate_)) return false;
+  // Deserialization of the values might have deprecated the map.
+  Handle<Map> map =
+      Map::Update(isolate_, handle(Cast<Map>(maybe_map), isolate_));
+  if (map->is_dictionary_map() ||
+      map->NumberOfOwnDescriptors() != static_cast<int>(values.size())) {
+    return false;
+  }
+
+  // Like in ReadJSObjectProperties, the values have to fit the field
+  // representations, though the field types can be generalized.
+  for (InternalIndex descriptor : map->IterateOwnDescriptors()) {
+    const Handle<Object>& value = values[descriptor.as_int()];
+    PropertyDetails details =
+        map->instance_descriptors(isolate_)->GetDetails(descriptor);
+    Representation expected_representation = details.representation();
+    if (details.location() != PropertyLocation::kField ||
+        !Object::FitsRepresentation(*value, expected_representation)) {
+      return false;
+    }
+    if (expected_representation.IsHeapObject() &&
+        !FieldType::NowContains(
+            map->instance_descriptors(isolate_)->GetFieldType(descriptor),
+            value)) {
+      Handle<FieldType> value_type =
+          Object::OptimalType(*value, isolate_, expected_representation);
+      MapUpdater::GeneralizeField(isolate_, map, descriptor,
+                                  details.constness(), expected_representation,
+                                  value_type);
+    }
+  }
+  CommitProperties(object, map, values);
+  object_shapes_->set(2 * shape_id + 1, *map);
+  return true;
+}
+
 Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     Handle<JSObject> object, SerializationTag end_tag,
     bool can_use_transitions) {
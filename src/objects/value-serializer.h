@@ -6,6 +6,7 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <vector>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -27,6 +28,7 @@ class JSArrayBuffer;
 class JSArrayBufferView;
 class JSDate;
 class JSMap;
+class Map;
 class JSPrimitiveWrapper;
 class JSRegExp;
 class JSSet;
@@ -97,6 +99,14 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to write the keys of plain objects with the same map only
+   * once, as an object shape that subsequent objects refer to by ID.
+   *
+   * The default is to write the keys of every object.
+   */
+  void SetUseObjectShapes(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -122,6 +132,11 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteJSObjectWithShape(Handle<JSObject> object,
+                                     DirectHandle<Map> map,
+                                     uint32_t* shape_entry)
+      V8_WARN_UNUSED_RESULT;
+  bool IsObjectShapeCandidate(Tagged<Map> map);
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(Tagged<JSDate> date);
   Maybe<bool> WriteJSPrimitiveWrapper(DirectHandle<JSPrimitiveWrapper> value)
@@ -177,6 +192,7 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool use_object_shapes_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
@@ -189,6 +205,11 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Maps the maps of objects written so far to the ID+1 of their object shape,
+  // or to kNoObjectShape if objects with that map aren't written as shapes.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> object_shape_map_;
+  uint32_t next_object_shape_id_ = 0;
+
   // The conveyor used to keep shared objects alive.
   SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -285,6 +306,8 @@ class ValueDeserializer {
   MaybeHandle<String> ReadTwoByteString(
       AllocationType allocation = AllocationType::kYoung) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadJSObjectWithShape(bool is_new_shape)
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -297,6 +320,8 @@ class ValueDeserializer {
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       DirectHandle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   bool ValidateJSArrayBufferViewFlags(
@@ -318,6 +343,18 @@ class ValueDeserializer {
                                          SerializationTag end_tag,
                                          bool can_use_transitions);
 
+  /*
+   * Reads the keys of a new object shape and returns its ID.
+   */
+  Maybe<uint32_t> ReadObjectShape() V8_WARN_UNUSED_RESULT;
+
+  /*
+   * Initializes |object| with the map recorded for the object shape, if the
+   * |values| fit its field representations. Returns false otherwise.
+   */
+  bool TryCommitObjectShapeMap(Handle<JSObject> object, uint32_t shape_id,
+                               const std::vector<Handle<Object>>& values);
+
   // Manipulating the map from IDs to reified objects.
   bool HasObjectWithID(uint32_t id);
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
@@ -335,6 +372,10 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  // For each object shape, the FixedArray of its keys followed by the map of
+  // the last object read with that shape (or undefined).
+  Handle<FixedArray> object_shapes_;
+  uint32_t num_object_shapes_ = 0;
 
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
@@ -69,6 +69,16 @@ class V8_NODISCARD WaiterQueueNode {
 
   virtual void Notify() = 0;
 
+  // Called on a mutex waiter that was dequeued with the waiter queue lock held,
+  // before it is notified, to transfer the ownership of the still locked mutex
+  // to it. Returns false if the waiter cannot take over the mutex, in which
+  // case the mutex has to be unlocked before notifying it.
+  virtual bool AcceptHandoff() { return false; }
+
+  // Whether the waiter stopped waiting because its timeout expired. A waiter
+  // that timed out never accepts a handoff, and dequeues itself.
+  virtual bool HasTimedOut() { return false; }
+
   // Async cleanup functions.
   virtual bool IsSameIsolateForAsyncCleanup(Isolate* isolate) = 0;
   virtual void CleanupMatchingAsyncWaiters(const DequeueMatcher& matcher) = 0;
@@ -41,6 +41,21 @@ void LiteralBuffer::ExpandBuffer() {
   backing_store_ = new_store;
 }
 
+void LiteralBuffer::AddAsciiCharsSlow(
+    base::Vector<const uint16_t> code_units) {
+  int char_size = is_one_byte() ? kOneByteSize : base::kUC16Size;
+  int size = code_units.length() * char_size;
+  while (backing_store_.length() - position_ < size) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(&backing_store_[position_], code_units.begin(),
+              code_units.length());
+  } else {
+    CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]),
+              code_units.begin(), code_units.length());
+  }
+  position_ += size;
+}
+
 void LiteralBuffer::ConvertToTwoByte() {
   DCHECK(is_one_byte());
   base::Vector<uint8_t> new_store;
@@ -38,6 +38,13 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of ASCII code units at once, as found by the vectorized
+  // scanning fast paths.
+  V8_INLINE void AddAsciiChars(base::Vector<const uint16_t> code_units) {
+    if (code_units.empty()) return;
+    AddAsciiCharsSlow(code_units);
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
@@ -93,6 +100,7 @@ class LiteralBuffer final {
   }
 
   void AddTwoByteChar(base::uc32 code_unit);
+  void AddAsciiCharsSlow(base::Vector<const uint16_t> code_units);
   int NewCapacity(int min_capacity);
   V8_NOINLINE V8_PRESERVE_MOST void ExpandBuffer();
   void ConvertToTwoByte();
@@ -0,0 +1,446 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "src/ast/ast-value-factory.h"
+#include "src/ast/ast.h"
+#include "src/ast/scopes.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/parsing/pending-compilation-error-handler.h"
+#include "src/parsing/preparse-data.h"
+#include "src/parsing/preparser.h"
+#include "src/parsing/scanner.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+class ParallelPreparser::JobTask : public v8::JobTask {
+ public:
+  explicit JobTask(ParallelPreparser* parallel_preparser)
+      : parallel_preparser_(parallel_preparser) {}
+
+  void Run(JobDelegate* delegate) final {
+    parallel_preparser_->RunOnWorker(delegate);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return parallel_preparser_->GetMaxConcurrency(worker_count);
+  }
+
+ private:
+  ParallelPreparser* parallel_preparser_;
+};
+
+ParallelPreparser::ParallelPreparser(
+    std::unique_ptr<Utf16CharacterStream> stream, int start_position,
+    UnoptimizedCompileFlags flags, LanguageMode language_mode,
+    const AstStringConstants* ast_string_constants, uint64_t hash_seed,
+    AccountingAllocator* allocator)
+    : flags_(flags),
+      language_mode_(language_mode),
+      ast_string_constants_(ast_string_constants),
+      hash_seed_(hash_seed),
+      allocator_(allocator),
+      stream_(std::move(stream)) {
+  DCHECK(stream_->can_be_cloned_for_parallel_access());
+  {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.ParallelPreparse.Prescan");
+    Prescan(stream_.get(), start_position);
+  }
+  if (candidates_.empty()) return;
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::make_unique<JobTask>(this));
+  // Makes it deterministic which functions are skipped using the results.
+  if (v8_flags.parallel_preparse_join_for_testing) job_handle_->Join();
+}
+
+ParallelPreparser::~ParallelPreparser() {
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+namespace {
+
+// Keywords after which a '/' starts a regular expression literal rather than
+// a division.
+bool IsKeywordBeforeExpression(std::string_view word) {
+  static constexpr std::string_view kKeywords[] = {
+      "await", "case", "delete", "do",   "else",  "in",   "instanceof",
+      "new",   "of",   "return", "throw", "typeof", "void", "yield"};
+  return std::find(std::begin(kKeywords), std::end(kKeywords), word) !=
+         std::end(kKeywords);
+}
+
+}  // namespace
+
+void ParallelPreparser::Prescan(Utf16CharacterStream* stream,
+                                int start_position) {
+  static constexpr base::uc32 kEndOfInput = Utf16CharacterStream::kEndOfInput;
+  stream->Seek(start_position);
+
+  // The depth of brackets of all kinds, and the depths at which the template
+  // literals with open substitutions started.
+  int depth = 0;
+  std::vector<int> template_depths;
+  // Whether a '/' starts a regular expression literal rather than a division,
+  // and whether a statement (and with it a function declaration) may start.
+  bool regexp_allowed = true;
+  bool statement_start = false;
+  bool after_async = false;
+  bool after_dot = false;
+  // The candidate whose parameters or body we are in, if any.
+  Candidate* open_candidate = nullptr;
+
+  // Advances to the end of an identifier or keyword starting with {c} and
+  // returns it if it consists of few enough ASCII characters to be a keyword.
+  static constexpr size_t kMaxKeywordLength = 10;
+  char buffer[kMaxKeywordLength];
+  auto scan_word = [stream, &buffer](base::uc32 c) {
+    size_t length = 0;
+    bool keyword = true;
+    do {
+      if (c > 0x7F || c == '\\' || length == kMaxKeywordLength) {
+        keyword = false;
+      } else {
+        buffer[length++] = static_cast<char>(c);
+      }
+      c = stream->Advance();
+    } while (c != kEndOfInput && (IsIdentifierPart(c) || c == '\\'));
+    stream->Back();
+    return keyword ? std::string_view(buffer, length) : std::string_view();
+  };
+  auto skip_whitespace = [stream]() {
+    base::uc32 c;
+    do {
+      c = stream->Advance();
+    } while (c != kEndOfInput && IsWhiteSpaceOrLineTerminator(c));
+    return c;
+  };
+  // Skips a template span, up to the end of the template literal or the start
+  // of a substitution.
+  auto skip_template_span = [&]() {
+    while (true) {
+      base::uc32 c = stream->AdvanceUntil(
+          [](base::uc32 u) { return u == '`' || u == '\\' || u == '$'; });
+      if (c == kEndOfInput || c == '`') {
+        regexp_allowed = false;
+        return;
+      }
+      if (c == '\\') {
+        stream->Advance();
+      } else if (stream->Peek() == '{') {
+        stream->Advance();
+        template_depths.push_back(depth++);
+        regexp_allowed = true;
+        return;
+      }
+    }
+  };
+  // Checks whether the `function` keyword that was just scanned starts a
+  // function declaration, and if so, records a candidate for it.
+  auto scan_function_declaration = [&]() {
+    bool is_generator = false;
+    base::uc32 c = skip_whitespace();
+    if (c == '*') {
+      is_generator = true;
+      c = skip_whitespace();
+    }
+    if (c == kEndOfInput || !IsIdentifierStart(c)) {
+      stream->Back();
+      return;
+    }
+    scan_word(c);
+    c = skip_whitespace();
+    if (c != '(') {
+      stream->Back();
+      return;
+    }
+    FunctionKind kind =
+        after_async ? (is_generator ? FunctionKind::kAsyncGeneratorFunction
+                                    : FunctionKind::kAsyncFunction)
+                    : (is_generator ? FunctionKind::kGeneratorFunction
+                                    : FunctionKind::kNormalFunction);
+    candidates_.push_back(std::make_unique<Candidate>(
+        static_cast<int>(stream->pos()) - 1, kind));
+    open_candidate = candidates_.back().get();
+    depth++;
+    regexp_allowed = true;
+    statement_start = false;
+  };
+
+  while (depth >= 0) {
+    base::uc32 c = stream->Advance();
+    switch (c) {
+      case kEndOfInput:
+        return;
+      case '(':
+      case '[':
+        depth++;
+        regexp_allowed = true;
+        statement_start = false;
+        break;
+      case '{':
+        depth++;
+        regexp_allowed = true;
+        statement_start = true;
+        break;
+      case ')':
+      case ']':
+        depth--;
+        regexp_allowed = false;
+        statement_start = false;
+        break;
+      case '}':
+        depth--;
+        if (!template_depths.empty() && template_depths.back() == depth) {
+          template_depths.pop_back();
+          skip_template_span();
+          statement_start = false;
+          break;
+        }
+        if (depth == 0 && open_candidate != nullptr) {
+          // Drop candidates that are too small to be worth preparsing on
+          // another thread.
+          int size = static_cast<int>(stream->pos()) - open_candidate->position;
+          if (size < v8_flags.parallel_preparse_min_function_size) {
+            candidates_.pop_back();
+          }
+          open_candidate = nullptr;
+        }
+        regexp_allowed = true;
+        statement_start = true;
+        break;
+      case ';':
+        regexp_allowed = true;
+        statement_start = true;
+        break;
+      case '\'':
+      case '"':
+        do {
+          c = stream->AdvanceUntil([quote = c](base::uc32 u) {
+            return u == quote || u == '\\' || unibrow::IsLineTerminator(u);
+          });
+          if (c == '\\') stream->Advance();
+        } while (c == '\\');
+        regexp_allowed = false;
+        statement_start = false;
+        break;
+      case '`':
+        skip_template_span();
+        statement_start = false;
+        break;
+      case '/':
+        if (stream->Peek() == '/') {
+          c = stream->AdvanceUntil(
+              [](base::uc32 u) { return unibrow::IsLineTerminator(u); });
+          // Let the line terminator be handled below.
+          if (c != kEndOfInput) stream->Back();
+        } else if (stream->Peek() == '*') {
+          stream->Advance();
+          do {
+            c = stream->AdvanceUntil([](base::uc32 u) { return u == '*'; });
+          } while (c != kEndOfInput && stream->Peek() != '/');
+          stream->Advance();
+        } else if (regexp_allowed) {
+          bool in_class = false;
+          while (true) {
+            c = stream->Advance();
+            if (c == kEndOfInput || unibrow::IsLineTerminator(c)) break;
+            if (c == '\\') {
+              stream->Advance();
+            } else if (c == '[') {
+              in_class = true;
+            } else if (c == ']') {
+              in_class = false;
+            } else if (c == '/' && !in_class) {
+              break;
+            }
+          }
+          regexp_allowed = false;
+          statement_start = false;
+        } else {
+          regexp_allowed = true;
+          statement_start = false;
+        }
+        break;
+      default:
+        if (c == '.' && !IsDecimalDigit(stream->Peek())) {
+          after_dot = true;
+          regexp_allowed = false;
+          statement_start = false;
+        } else if (IsDecimalDigit(c) || c == '.') {
+          do {
+            c = stream->Advance();
+          } while (IsAlphaNumeric(c) || c == '.' || c == '_');
+          stream->Back();
+          regexp_allowed = false;
+          statement_start = false;
+        } else if (unibrow::IsLineTerminator(c)) {
+          // Automatic semicolon insertion may end the previous statement.
+          if (depth == 0) statement_start = true;
+          after_async = false;
+        } else if (IsWhiteSpace(c)) {
+          // Nothing to do.
+        } else if (IsIdentifierStart(c) || c == '\\') {
+          std::string_view word = scan_word(c);
+          if (after_dot) {
+            // A property name.
+            after_dot = false;
+            regexp_allowed = false;
+            statement_start = false;
+          } else if (word == "function" && depth == 0 && statement_start) {
+            scan_function_declaration();
+            after_async = false;
+          } else {
+            after_async = statement_start && word == "async";
+            statement_start = after_async;
+            regexp_allowed = IsKeywordBeforeExpression(word);
+          }
+        } else {
+          // An operator.
+          regexp_allowed = true;
+          statement_start = false;
+        }
+        break;
+    }
+  }
+}
+
+void ParallelPreparser::RunOnWorker(JobDelegate* delegate) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.ParallelPreparse");
+  while (!delegate->ShouldYield()) {
+    size_t index = next_to_preparse_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= candidates_.size()) return;
+    Candidate* candidate = candidates_[index].get();
+    State expected = State::kPending;
+    if (!candidate->state.compare_exchange_strong(expected, State::kRunning)) {
+      continue;
+    }
+    std::unique_ptr<Result> result = Preparse(*candidate);
+    {
+      base::MutexGuard guard(&mutex_);
+      candidate->result = std::move(result);
+      candidate->state.store(candidate->result ? State::kDone
+                                               : State::kFailed);
+    }
+    done_cv_.NotifyAll();
+  }
+}
+
+size_t ParallelPreparser::GetMaxConcurrency(size_t worker_count) const {
+  size_t next = next_to_preparse_.load(std::memory_order_relaxed);
+  return next < candidates_.size() ? candidates_.size() - next : 0;
+}
+
+std::unique_ptr<ParallelPreparser::Result> ParallelPreparser::Preparse(
+    const Candidate& candidate) {
+  std::unique_ptr<Utf16CharacterStream> stream;
+  {
+    base::MutexGuard guard(&mutex_);
+    stream = stream_->Clone();
+  }
+  stream->Seek(candidate.position);
+  Scanner scanner(stream.get(), flags_);
+  scanner.Initialize();
+  if (scanner.Next() != Token::kLeftParen) return {};
+  DCHECK_EQ(candidate.position, scanner.location().beg_pos);
+
+  auto result = std::make_unique<Result>();
+  result->zone = std::make_unique<Zone>(allocator_, "parallel-preparse-zone");
+  Zone* zone = result->zone.get();
+  // Like the Parser's preparser zone, this is reset after preparsing.
+  Zone preparser_zone(allocator_, "parallel-preparser-zone");
+  AstValueFactory ast_value_factory(zone, ast_string_constants_, hash_seed_);
+  PendingCompilationErrorHandler pending_error_handler;
+  PreParser preparser(&preparser_zone, &scanner,
+                      GetCurrentStackPosition() - v8_flags.stack_size * KB,
+                      &ast_value_factory, &pending_error_handler, nullptr,
+                      nullptr, flags_, false);
+
+  DeclarationScope* script_scope =
+      zone->New<DeclarationScope>(zone, &ast_value_factory);
+  DeclarationScope* function_scope = zone->New<DeclarationScope>(
+      &preparser_zone, script_scope, FUNCTION_SCOPE, candidate.kind);
+  function_scope->DeclareDefaultFunctionVariables(&ast_value_factory);
+  function_scope->SetLanguageMode(language_mode_);
+  function_scope->set_start_position(candidate.position);
+
+  ProducedPreparseData* preparse_data = nullptr;
+  PreParser::PreParseResult preparse_result = preparser.PreParseFunction(
+      ast_value_factory.empty_string(), candidate.kind,
+      FunctionSyntaxKind::kDeclaration, function_scope, result->use_counts,
+      &preparse_data);
+  // Errors are left to the Parser, which reports them when it preparses the
+  // function itself. Magic comments in the function are only recorded by the
+  // Parser's scanner.
+  if (preparse_result != PreParser::kPreParseSuccess ||
+      pending_error_handler.has_pending_error() ||
+      scanner.SawMagicComment() || scanner.FoundHtmlComment()) {
+    return {};
+  }
+
+  PreParserLogger* logger = preparser.logger();
+  function_scope->set_end_position(logger->end());
+  result->end_position = logger->end();
+  result->num_parameters = logger->num_parameters();
+  result->function_length = logger->function_length();
+  result->num_inner_infos = logger->num_inner_infos();
+  result->language_mode = function_scope->language_mode();
+  result->uses_super_property = function_scope->uses_super_property();
+  result->allow_eval_cache = preparser.allow_eval_cache();
+
+  AstNodeFactory ast_node_factory(&ast_value_factory, zone);
+  std::vector<uint8_t> preparse_data_buffer;
+  function_scope->AnalyzePartially(&ast_node_factory, &preparse_data_buffer,
+                                   false);
+  result->preparse_data = preparse_data;
+  return result;
+}
+
+std::unique_ptr<ParallelPreparser::Result> ParallelPreparser::TakeResult(
+    int position, FunctionKind kind) {
+  while (next_to_take_ < candidates_.size() &&
+         candidates_[next_to_take_]->position < position) {
+    Drop(candidates_[next_to_take_++].get());
+  }
+  if (next_to_take_ == candidates_.size() ||
+      candidates_[next_to_take_]->position != position) {
+    return {};
+  }
+  Candidate* candidate = candidates_[next_to_take_++].get();
+  State state = State::kPending;
+  if (candidate->state.compare_exchange_strong(state, State::kDropped)) {
+    return {};
+  }
+  if (state == State::kRunning) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.ParallelPreparse.Wait");
+    base::MutexGuard guard(&mutex_);
+    while ((state = candidate->state.load()) == State::kRunning) {
+      done_cv_.Wait(&mutex_);
+    }
+  }
+  if (state != State::kDone || candidate->kind != kind) return {};
+  return std::move(candidate->result);
+}
+
+void ParallelPreparser::Drop(Candidate* candidate) {
+  State state = State::kPending;
+  if (candidate->state.compare_exchange_strong(state, State::kDropped)) return;
+  // Results of candidates that are still being preparsed are freed with the
+  // ParallelPreparser.
+  if (state != State::kRunning) candidate->result.reset();
+}
+
+}  // namespace internal
+}  // namespace v8
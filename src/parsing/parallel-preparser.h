@@ -0,0 +1,127 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/objects/function-kind.h"
+#include "src/parsing/parse-info.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+class AccountingAllocator;
+class AstStringConstants;
+class ProducedPreparseData;
+class Utf16CharacterStream;
+
+// Preparses the top-level function declarations of a script on background
+// threads, ahead of the Parser reaching them.
+//
+// A pre-scan over the characters of the rest of the script, which only
+// matches brackets and skips comments, string, template and regular
+// expression literals, finds the function declarations at bracket depth 0
+// together with the opening parenthesis of their parameter lists. Workers
+// then preparse these candidates, each with its own Scanner, PreParser, Zone
+// and AstValueFactory, exactly like the Parser's reusable preparser would
+// when skipping a top-level function.
+//
+// The pre-scan is a heuristic. Its results are only used if the Parser is
+// about to skip a top-level function declaration of the same kind at the
+// same position. Since the preparsing of top-level functions doesn't depend
+// on anything that precedes them except for the language mode, preparsing
+// them sequentially would have given the same result in that case.
+class ParallelPreparser final {
+ public:
+  // What the Parser needs to skip a function, see Parser::SkipFunction.
+  struct Result {
+    // Owns the preparse data and all other zone allocations of the worker.
+    std::unique_ptr<Zone> zone;
+    int end_position;
+    int num_parameters;
+    int function_length;
+    int num_inner_infos;
+    LanguageMode language_mode;
+    bool uses_super_property;
+    bool allow_eval_cache;
+    ProducedPreparseData* preparse_data = nullptr;
+    int use_counts[v8::Isolate::kUseCounterFeatureCount] = {};
+  };
+
+  // Pre-scans {stream} from {start_position}, the opening parenthesis of a
+  // top-level function that the Parser preparses itself, and posts a job that
+  // preparses the candidates after it. {stream} must be cloneable for
+  // parallel access.
+  ParallelPreparser(std::unique_ptr<Utf16CharacterStream> stream,
+                    int start_position, UnoptimizedCompileFlags flags,
+                    LanguageMode language_mode,
+                    const AstStringConstants* ast_string_constants,
+                    uint64_t hash_seed, AccountingAllocator* allocator);
+  ~ParallelPreparser();
+  ParallelPreparser(const ParallelPreparser&) = delete;
+  ParallelPreparser& operator=(const ParallelPreparser&) = delete;
+
+  // Returns the result for the function of {kind} whose parameter list starts
+  // at {position}, waiting for the worker that preparses it if necessary.
+  // Returns nullptr if the function is not a candidate, if no worker started
+  // preparsing it yet (in which case the caller is expected to preparse it
+  // itself), or if the worker failed. Must be called with increasing
+  // positions; candidates before {position} are dropped.
+  std::unique_ptr<Result> TakeResult(int position, FunctionKind kind);
+
+  size_t candidate_count() const { return candidates_.size(); }
+
+ private:
+  class JobTask;
+
+  enum class State : uint8_t { kPending, kRunning, kDone, kFailed, kDropped };
+
+  struct Candidate {
+    Candidate(int position, FunctionKind kind)
+        : position(position), kind(kind) {}
+
+    const int position;
+    const FunctionKind kind;
+    std::atomic<State> state{State::kPending};
+    std::unique_ptr<Result> result;
+  };
+
+  void Prescan(Utf16CharacterStream* stream, int start_position);
+  void RunOnWorker(JobDelegate* delegate);
+  size_t GetMaxConcurrency(size_t worker_count) const;
+  std::unique_ptr<Result> Preparse(const Candidate& candidate);
+  void Drop(Candidate* candidate);
+
+  const UnoptimizedCompileFlags flags_;
+  const LanguageMode language_mode_;
+  const AstStringConstants* const ast_string_constants_;
+  const uint64_t hash_seed_;
+  AccountingAllocator* const allocator_;
+
+  // Read by the pre-scan, and then only cloned by the workers.
+  std::unique_ptr<Utf16CharacterStream> stream_;
+  std::vector<std::unique_ptr<Candidate>> candidates_;
+  std::atomic<size_t> next_to_preparse_{0};
+  // Only accessed by the Parser.
+  size_t next_to_take_ = 0;
+
+  base::Mutex mutex_;
+  base::ConditionVariable done_cv_;
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
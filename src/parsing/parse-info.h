@@ -331,6 +331,15 @@ class V8_EXPORT_PRIVATE ParseInfo {
   int max_info_id() const { return max_info_id_; }
   void set_max_info_id(int max_info_id) { max_info_id_ = max_info_id; }
 
+  // The number of top-level functions that were skipped using the result of
+  // the ParallelPreparser.
+  int parallel_preparsed_function_count() const {
+    return parallel_preparsed_function_count_;
+  }
+  void count_parallel_preparsed_function() {
+    ++parallel_preparsed_function_count_;
+  }
+
   void AllocateSourceRangeMap();
   SourceRangeMap* source_range_map() const { return source_range_map_; }
   void set_source_range_map(SourceRangeMap* source_range_map) {
@@ -395,6 +404,7 @@ class V8_EXPORT_PRIVATE ParseInfo {
 
   //----------- Output of parsing and scope analysis ------------------------
   FunctionLiteral* literal_;
+  int parallel_preparsed_function_count_ = 0;
   bool allow_eval_cache_ : 1;
 #if V8_ENABLE_WEBASSEMBLY
   bool contains_asm_module_ : 1;
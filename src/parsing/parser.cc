@@ -3013,6 +3013,47 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  if (V8_UNLIKELY(v8_flags.parallel_preparse) && !has_error() &&
+      function_syntax_kind == FunctionSyntaxKind::kDeclaration &&
+      function_scope->outer_scope()->is_script_scope()) {
+    std::unique_ptr<ParallelPreparser::Result> result =
+        TakeParallelPreparseResult(function_scope->start_position(), kind,
+                                   function_scope->language_mode());
+    if (result) {
+      int end_position = result->end_position;
+      function_scope->set_end_position(end_position);
+      scanner()->SeekForward(end_position - 1);
+      Expect(Token::kRightBrace);
+      total_preparse_skipped_ +=
+          end_position - function_scope->start_position();
+      *num_parameters = result->num_parameters;
+      *function_length = result->function_length;
+      // The use of the language mode was counted by the worker.
+      function_scope->SetLanguageMode(result->language_mode);
+      if (result->uses_super_property) {
+        function_scope->RecordSuperPropertyUsage();
+      }
+      if (!result->allow_eval_cache) {
+        set_allow_eval_cache(false);
+        reusable_preparser()->set_allow_eval_cache(false);
+      }
+      for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+           ++feature) {
+        use_counts_[feature] += result->use_counts[feature];
+      }
+      // The preparse data is copied out of the worker's zone, which is freed
+      // with the result.
+      if (result->preparse_data != nullptr) {
+        *produced_preparse_data = ProducedPreparseData::For(
+            result->preparse_data->Serialize(main_zone()), main_zone());
+      }
+      SkipInfos(result->num_inner_infos);
+      function_scope->ResetAfterPreparsing(ast_value_factory_, false);
+      info()->count_parallel_preparsed_function();
+      return true;
+    }
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
@@ -3070,12 +3111,34 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
       private_name_scope_iter.GetScope()->MigrateUnresolvedPrivateNameTail(
           factory(), unresolved_private_tail);
     }
-    function_scope->AnalyzePartially(this, factory(), MaybeParsingArrowhead());
+    function_scope->AnalyzePartially(factory(), preparse_data_buffer(),
+                                     MaybeParsingArrowhead());
   }
 
   return true;
 }
 
+std::unique_ptr<ParallelPreparser::Result> Parser::TakeParallelPreparseResult(
+    int position, FunctionKind kind, LanguageMode language_mode) {
+  if (!parallel_preparser_) {
+    if (tried_parallel_preparse_) return {};
+    tried_parallel_preparse_ = true;
+    // Only the top-level functions of classic scripts are preparsed in
+    // parallel, and only if the source is readily available to other threads.
+    if (!flags().is_toplevel() || flags().is_eval() || flags().is_module() ||
+        flags().is_repl_mode() || info()->is_streaming_compilation() ||
+        !scanner()->stream()->can_be_cloned_for_parallel_access() ||
+        v8_flags.log_function_events) {
+      return {};
+    }
+    parallel_preparser_ = std::make_unique<ParallelPreparser>(
+        scanner()->stream()->Clone(), position, flags(), language_mode,
+        info()->ast_string_constants(), info()->hash_seed(),
+        main_zone()->allocator());
+  }
+  return parallel_preparser_->TakeResult(position, kind);
+}
+
 Block* Parser::BuildParameterInitializationBlock(
     const ParserFormalParameters& parameters) {
   DCHECK(!parameters.is_simple);
@@ -17,6 +17,7 @@
 #include "src/base/threaded-list.h"
 #include "src/common/globals.h"
 #include "src/parsing/import-assertions.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/parsing.h"
@@ -472,6 +473,13 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                     int* function_length,
                     ProducedPreparseData** produced_preparsed_scope_data);
 
+  // Returns the result of preparsing the top-level function declaration whose
+  // parameters start at {position} on a background thread, if there is one.
+  // The first call starts preparsing the following top-level functions in
+  // parallel, if possible.
+  std::unique_ptr<ParallelPreparser::Result> TakeParallelPreparseResult(
+      int position, FunctionKind kind, LanguageMode language_mode);
+
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters);
 
@@ -1106,7 +1114,6 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
 
   // Parser's private field members.
   friend class PreParserZoneScope;  // Uses reusable_preparser().
-  friend class PreparseDataBuilder;  // Uses preparse_data_buffer()
 
   LocalIsolate* local_isolate_;
   ParseInfo* info_;
@@ -1134,6 +1141,8 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
   std::vector<uint8_t> preparse_data_buffer_;
+  std::unique_ptr<ParallelPreparser> parallel_preparser_;
+  bool tried_parallel_preparse_ = false;
 
   // If not kNoSourcePosition, indicates that the first function literal
   // encountered is a dynamic function, see CreateDynamicFunction(). This field
@@ -312,12 +312,12 @@ bool PreparseDataBuilder::SaveDataForSkippableFunction(
   return has_data;
 }
 
-void PreparseDataBuilder::SaveScopeAllocationData(DeclarationScope* scope,
-                                                  Parser* parser) {
+void PreparseDataBuilder::SaveScopeAllocationData(
+    DeclarationScope* scope, std::vector<uint8_t>* buffer, Zone* zone) {
   if (!has_data_) return;
   DCHECK(HasInnerFunctions());
 
-  byte_data_.Start(parser->preparse_data_buffer());
+  byte_data_.Start(buffer);
 
 #ifdef DEBUG
   // Reserve Uint32 for scope_data_start debug info.
@@ -350,7 +350,7 @@ void PreparseDataBuilder::SaveScopeAllocationData(DeclarationScope* scope,
 
   if (ScopeNeedsData(scope)) SaveDataForScope(scope);
   }
-  byte_data_.Finalize(parser->factory()->zone());
+  byte_data_.Finalize(zone);
 }
 
 void PreparseDataBuilder::SaveDataForScope(Scope* scope) {
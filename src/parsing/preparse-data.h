@@ -21,7 +21,6 @@ namespace internal {
 template <typename T>
 class PodArray;
 
-class Parser;
 class PreParser;
 class PreparseData;
 class ZonePreparseData;
@@ -178,8 +177,9 @@ class V8_EXPORT_PRIVATE PreparseDataBuilder : public ZoneObject,
   };
 
   // Saves the information needed for allocating the Scope's (and its
-  // subscopes') variables.
-  void SaveScopeAllocationData(DeclarationScope* scope, Parser* parser);
+  // subscopes') variables into {zone}, using {buffer} as scratch space.
+  void SaveScopeAllocationData(DeclarationScope* scope,
+                               std::vector<uint8_t>* buffer, Zone* zone);
 
   // In some cases, PreParser cannot produce the same Scope structure as
   // Parser. If it happens, we're unable to produce the data that would enable
@@ -277,25 +277,42 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
-      });
+      AdvanceUntil(
+          [this, &scan_flags](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              // A non-ascii character means we need to drop through to the
+              // slow path.
+              // TODO(leszeks): This would be most efficient as a goto to the
+              // slow path, check codegen and maybe use a bool instead.
+              scan_flags |=
+                  static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+              return true;
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            scan_flags |= char_flags;
+            if (TerminatesLiteral(char_flags)) {
+              return true;
+            } else {
+              AddLiteralChar(static_cast<char>(c0));
+              return false;
+            }
+          },
+          [this, &scan_flags](const uint16_t* begin, const uint16_t* end) {
+            const uint16_t* run_end =
+                scanner_simd::SkipRun<scanner_simd::AsciiIdentifierParts>(
+                    begin, end);
+            base::Vector<const uint16_t> run(begin, run_end - begin);
+            if (run.empty()) return run_end;
+            next().literal_chars.AddAsciiChars(run);
+            // Identifier parts only contribute to the keyword flag, and
+            // identifiers longer than all keywords cannot be keywords.
+            if (next().literal_chars.length() > MAX_WORD_LENGTH) {
+              scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+            } else {
+              for (uint16_t c : run) scan_flags |= character_scan_flags[c];
+            }
+            return run_end;
+          });
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::kIdentifier;
@@ -331,17 +348,20 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
   base::uc32 hint = ' ';
-  AdvanceUntil([this, &hint](base::uc32 c0) {
-    if (V8_LIKELY(c0 == hint)) return false;
-    if (IsWhiteSpaceOrLineTerminator(c0)) {
-      if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
-        next().after_line_terminator = true;
-      }
-      hint = c0;
-      return false;
-    }
-    return true;
-  });
+  AdvanceUntil(
+      [this, &hint](base::uc32 c0) {
+        if (V8_LIKELY(c0 == hint)) return false;
+        if (IsWhiteSpaceOrLineTerminator(c0)) {
+          if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
+            next().after_line_terminator = true;
+          }
+          hint = c0;
+          return false;
+        }
+        return true;
+      },
+      // Runs of indentation.
+      SkipRun<scanner_simd::OneOf<' ', '\t'>>());
 
   return Token::kWhitespace;
 }
@@ -0,0 +1,178 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if (defined(__SSE2__) || \
+     (defined(_MSC_VER) && \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2))))
+#define V8_SCANNER_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64) && \
+    (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define V8_SCANNER_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(V8_SCANNER_SIMD_SSE2) || defined(V8_SCANNER_SIMD_NEON)
+#define V8_SCANNER_SIMD 1
+#endif
+
+namespace v8::internal::scanner_simd {
+
+// Vectorized fast paths for the scanner, which classify the buffered UTF-16
+// code units of a Utf16CharacterStream eight at a time. Each classifier
+// computes the lanes of a vector at which a run of code units that the
+// scanner can consume without looking at them individually stops. Only whole
+// vectors are examined; the code units before the end of the buffer that
+// don't fill a vector are left to the scalar scanning loops.
+
+#if defined(V8_SCANNER_SIMD_SSE2)
+
+struct U16x8 {
+  using Vector = __m128i;
+  static constexpr int kLanes = 8;
+
+  static V8_INLINE Vector Load(const uint16_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  static V8_INLINE Vector Equal(Vector v, uint16_t c) {
+    return _mm_cmpeq_epi16(v, _mm_set1_epi16(static_cast<int16_t>(c)));
+  }
+  // Lanes with lo <= v <= hi.
+  static V8_INLINE Vector InRange(Vector v, uint16_t lo, uint16_t hi) {
+    Vector offset = _mm_sub_epi16(v, _mm_set1_epi16(static_cast<int16_t>(lo)));
+    Vector above = _mm_subs_epu16(
+        offset, _mm_set1_epi16(static_cast<int16_t>(hi - lo)));
+    return _mm_cmpeq_epi16(above, _mm_setzero_si128());
+  }
+  static V8_INLINE Vector OrBits(Vector v, uint16_t bits) {
+    return _mm_or_si128(v, _mm_set1_epi16(static_cast<int16_t>(bits)));
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  static V8_INLINE Vector Not(Vector v) {
+    return _mm_xor_si128(v, _mm_set1_epi32(-1));
+  }
+  // Returns the index of the first lane of {mask} that is set, or kLanes.
+  static V8_INLINE int FirstSetLane(Vector mask) {
+    uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+    if (bits == 0) return kLanes;
+    return base::bits::CountTrailingZerosNonZero(bits) / 2;
+  }
+};
+
+#elif defined(V8_SCANNER_SIMD_NEON)
+
+struct U16x8 {
+  using Vector = uint16x8_t;
+  static constexpr int kLanes = 8;
+
+  static V8_INLINE Vector Load(const uint16_t* p) { return vld1q_u16(p); }
+  static V8_INLINE Vector Equal(Vector v, uint16_t c) {
+    return vceqq_u16(v, vdupq_n_u16(c));
+  }
+  // Lanes with lo <= v <= hi.
+  static V8_INLINE Vector InRange(Vector v, uint16_t lo, uint16_t hi) {
+    return vcleq_u16(vsubq_u16(v, vdupq_n_u16(lo)), vdupq_n_u16(hi - lo));
+  }
+  static V8_INLINE Vector OrBits(Vector v, uint16_t bits) {
+    return vorrq_u16(v, vdupq_n_u16(bits));
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+  static V8_INLINE Vector Not(Vector v) { return vmvnq_u16(v); }
+  // Returns the index of the first lane of {mask} that is set, or kLanes.
+  static V8_INLINE int FirstSetLane(Vector mask) {
+    // Narrow each lane to a byte, which leaves one byte per lane in a 64-bit
+    // value.
+    uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(mask)), 0);
+    if (bits == 0) return kLanes;
+    return base::bits::CountTrailingZerosNonZero(bits) / 8;
+  }
+};
+
+#endif
+
+#ifdef V8_SCANNER_SIMD
+
+template <typename... Stops>
+V8_INLINE U16x8::Vector EqualAny(U16x8::Vector v, uint16_t stop,
+                                 Stops... stops) {
+  if constexpr (sizeof...(stops) == 0) {
+    return U16x8::Equal(v, stop);
+  } else {
+    return U16x8::Or(U16x8::Equal(v, stop), EqualAny(v, stops...));
+  }
+}
+
+#endif  // V8_SCANNER_SIMD
+
+// Runs of ASCII code units other than {stops}.
+template <uint16_t... stops>
+struct AsciiExcept {
+#ifdef V8_SCANNER_SIMD
+  static V8_INLINE U16x8::Vector StopLanes(U16x8::Vector v) {
+    return U16x8::Or(U16x8::Not(U16x8::InRange(v, 0, 0x7F)),
+                     EqualAny(v, stops...));
+  }
+#endif
+};
+
+// Runs of arbitrary code units other than {stops}.
+template <uint16_t... stops>
+struct AnyExcept {
+#ifdef V8_SCANNER_SIMD
+  static V8_INLINE U16x8::Vector StopLanes(U16x8::Vector v) {
+    return EqualAny(v, stops...);
+  }
+#endif
+};
+
+// Runs consisting of {chars} only.
+template <uint16_t... chars>
+struct OneOf {
+#ifdef V8_SCANNER_SIMD
+  static V8_INLINE U16x8::Vector StopLanes(U16x8::Vector v) {
+    return U16x8::Not(EqualAny(v, chars...));
+  }
+#endif
+};
+
+// Runs of the ASCII identifier parts [A-Za-z0-9_$].
+struct AsciiIdentifierParts {
+#ifdef V8_SCANNER_SIMD
+  static V8_INLINE U16x8::Vector StopLanes(U16x8::Vector v) {
+    // Setting the 0x20 bit maps upper case letters to lower case ones, and
+    // no other code unit to a lower case letter.
+    U16x8::Vector letter = U16x8::InRange(U16x8::OrBits(v, 0x20), 'a', 'z');
+    U16x8::Vector digit = U16x8::InRange(v, '0', '9');
+    U16x8::Vector other = EqualAny(v, '_', '$');
+    return U16x8::Not(U16x8::Or(U16x8::Or(letter, digit), other));
+  }
+#endif
+};
+
+// Returns the end of the run of code units in [begin, end) that {Classifier}
+// accepts, rounded down to whole vectors unless a stop was found.
+template <typename Classifier>
+V8_INLINE const uint16_t* SkipRun(const uint16_t* begin, const uint16_t* end) {
+#ifdef V8_SCANNER_SIMD
+  while (end - begin >= U16x8::kLanes) {
+    int lane = U16x8::FirstSetLane(Classifier::StopLanes(U16x8::Load(begin)));
+    begin += lane;
+    if (lane < U16x8::kLanes) break;
+  }
+#endif
+  return begin;
+}
+
+}  // namespace v8::internal::scanner_simd
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
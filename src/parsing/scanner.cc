@@ -236,7 +236,8 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); },
+               SkipRun<scanner_simd::AsciiExcept<'\n', '\r'>>());
 
   return Token::kWhitespace;
 }
@@ -315,13 +316,15 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntil(
+          [](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          },
+          SkipRun<scanner_simd::AsciiExcept<'*', '\n', '\r'>>());
 
       while (c0_ == '*') {
         Advance();
@@ -340,7 +343,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; },
+                 SkipRun<scanner_simd::AnyExcept<'*'>>());
 
     while (c0_ == '*') {
       Advance();
@@ -494,19 +498,29 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntil(
+        [this](base::uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        },
+        [this](const uint16_t* begin, const uint16_t* end) {
+          // Consume the string body up to the next character that may
+          // terminate the string.
+          using Body = scanner_simd::AsciiExcept<'\'', '"', '\\', '\n', '\r'>;
+          const uint16_t* run_end = scanner_simd::SkipRun<Body>(begin, end);
+          next().literal_chars.AddAsciiChars(
+              base::Vector<const uint16_t>(begin, run_end - begin));
+          return run_end;
+        });
 
     while (c0_ == '\\') {
       Advance();
@@ -608,17 +622,29 @@ Token::Value Scanner::ScanTemplateSpan() {
     } else if (c == kEndOfInput) {
       // Unterminated template literal
       break;
-    } else {
+    } else if (c == '\r') {
       Advance();  // Consume c.
       // The TRV of LineTerminatorSequence :: <CR> is the CV 0x000A.
       // The TRV of LineTerminatorSequence :: <CR><LF> is the sequence
       // consisting of the CV 0x000A.
-      if (c == '\r') {
-        if (c0_ == '\n') Advance();  // Consume '\n'
-        c = '\n';
-      }
+      if (c0_ == '\n') Advance();  // Consume '\n'
+      c = '\n';
       if (capture_raw) AddRawLiteralChar(c);
       AddLiteralChar(c);
+    } else {
+      // Consume c together with the run of ordinary ASCII characters that
+      // follows it, which are the same in the cooked and the raw strings.
+      // The run points into the buffer of the stream, so it has to be copied
+      // before Advance() refills the buffer.
+      base::Vector<const uint16_t> run = source_->AdvanceOverRun<
+          scanner_simd::AsciiExcept<'`', '$', '\\', '\r'>>();
+      if (capture_raw) {
+        AddRawLiteralChar(c);
+        next().raw_literal_chars.AddAsciiChars(run);
+      }
+      AddLiteralChar(c);
+      next().literal_chars.AddAsciiChars(run);
+      Advance();
     }
   }
   next().location.end_pos = source_pos();
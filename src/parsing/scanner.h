@@ -17,6 +17,7 @@
 #include "src/common/message-template.h"
 #include "src/parsing/literal-buffer.h"
 #include "src/parsing/parse-info.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/token.h"
 #include "src/regexp/regexp-flags.h"
 #include "src/strings/char-predicates.h"
@@ -95,6 +96,43 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but first lets {skip} consume runs of buffered code
+  // units that cannot meet the check, typically with the vectorized
+  // classifiers of scanner-simd.h. {skip} is called with the cursor and the
+  // end of the buffer and returns the new cursor. It must apply any side
+  // effects that {check} would have had on the skipped code units.
+  template <typename FunctionType, typename SkipFunction>
+  V8_INLINE base::uc32 AdvanceUntil(FunctionType check, SkipFunction skip) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (true) {
+        cursor = skip(cursor, buffer_end_);
+        if (cursor >= buffer_end_) break;
+        base::uc32 c0_ = static_cast<base::uc32>(*cursor++);
+        if (check(c0_)) {
+          buffer_cursor_ = cursor;
+          return c0_;
+        }
+      }
+
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
+  // Advances over the buffered code units that {Classifier} (see
+  // scanner-simd.h) accepts, without reading more input, and returns them.
+  // The returned code units are only valid until the next Advance().
+  template <typename Classifier>
+  V8_INLINE base::Vector<const uint16_t> AdvanceOverRun() {
+    const uint16_t* start = buffer_cursor_;
+    buffer_cursor_ = scanner_simd::SkipRun<Classifier>(start, buffer_end_);
+    return base::Vector<const uint16_t>(start, buffer_cursor_ - start);
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -440,6 +478,14 @@ class V8_EXPORT_PRIVATE Scanner {
 
   bool FoundHtmlComment() const { return found_html_comment_; }
 
+  // Returns true if the scanner saw any of the magic comments that it records
+  // for the script.
+  bool SawMagicComment() const {
+    return source_url_.length() > 0 || source_mapping_url_.length() > 0 ||
+           saw_source_mapping_url_magic_comment_at_sign_ ||
+           saw_magic_comment_compile_hints_all_;
+  }
+
   const Utf16CharacterStream* stream() const { return source_; }
 
  private:
@@ -559,6 +605,20 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType, typename SkipFunction>
+  V8_INLINE void AdvanceUntil(FunctionType check, SkipFunction skip) {
+    c0_ = source_->AdvanceUntil(check, skip);
+  }
+
+  // Returns a skip function for AdvanceUntil that consumes the runs that
+  // {Classifier} accepts without side effects.
+  template <typename Classifier>
+  static constexpr auto SkipRun() {
+    return [](const uint16_t* begin, const uint16_t* end) {
+      return scanner_simd::SkipRun<Classifier>(begin, end);
+    };
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
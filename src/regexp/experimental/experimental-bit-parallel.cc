@@ -0,0 +1,253 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-bit-parallel.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+std::unique_ptr<ExperimentalRegExpBitParallelNfa>
+ExperimentalRegExpBitParallelNfa::TryCreate(
+    base::Vector<const RegExpInstruction> bytecode, Zone* zone) {
+  // Number the non-empty CONSUME_RANGE instructions.
+  ZoneVector<int> state_of_pc(bytecode.length(), -1, zone);
+  ZoneVector<int> pc_of_state(zone);
+  for (int pc = 0; pc < bytecode.length(); ++pc) {
+    const RegExpInstruction& inst = bytecode[pc];
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE ||
+        inst.payload.consume_range.min > inst.payload.consume_range.max) {
+      continue;
+    }
+    if (pc_of_state.size() == kMaxStateCount) return nullptr;
+    state_of_pc[pc] = static_cast<int>(pc_of_state.size());
+    pc_of_state.push_back(pc);
+  }
+  const int state_count = static_cast<int>(pc_of_state.size());
+
+  // Computes the states and ACCEPT instructions that a thread at `start_pc`
+  // can reach without consuming input.
+  ZoneVector<int> visited_in_closure(bytecode.length(), -1, zone);
+  ZoneVector<int> worklist(zone);
+  int closure_index = 0;
+  auto closure = [&](int start_pc) {
+    StateSet states = 0;
+    worklist.push_back(start_pc);
+    while (!worklist.empty()) {
+      int pc = worklist.back();
+      worklist.pop_back();
+      if (pc < 0 || pc >= bytecode.length() ||
+          visited_in_closure[pc] == closure_index) {
+        continue;
+      }
+      visited_in_closure[pc] = closure_index;
+      const RegExpInstruction& inst = bytecode[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (state_of_pc[pc] >= 0) states |= StateSet{1} << state_of_pc[pc];
+          break;
+        case RegExpInstruction::ACCEPT:
+          states |= kAccept;
+          break;
+        case RegExpInstruction::FORK:
+          worklist.push_back(inst.payload.pc);
+          worklist.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.push_back(inst.payload.pc);
+          break;
+        // These only restrict which threads survive, or record positions.
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          worklist.push_back(pc + 1);
+          break;
+        // Threads of the main expression never run these.
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::FILTER_QUANTIFIER:
+        case RegExpInstruction::FILTER_GROUP:
+        case RegExpInstruction::FILTER_CHILD:
+          break;
+      }
+    }
+    ++closure_index;
+    return states;
+  };
+
+  Header header;
+  header.initial_states = closure(0);
+  ZoneVector<StateSet> successors(state_count, 0, zone);
+  for (int state = 0; state < state_count; ++state) {
+    successors[state] = closure(pc_of_state[state] + 1);
+  }
+
+  // Tabulate the successors of each subset of each chunk of states, building
+  // each subset's entry from the one without its lowest state.
+  header.chunk_count = (state_count + kStatesPerChunk - 1) / kStatesPerChunk;
+  ZoneVector<StateSet> successor_table(header.chunk_count * kChunkValues, 0,
+                                       zone);
+  for (int chunk = 0; chunk < header.chunk_count; ++chunk) {
+    StateSet* table = &successor_table[chunk * kChunkValues];
+    for (int subset = 1; subset < kChunkValues; ++subset) {
+      int state = chunk * kStatesPerChunk +
+                  base::bits::CountTrailingZerosNonZero(subset);
+      table[subset] = table[subset & (subset - 1)] |
+                      (state < state_count ? successors[state] : 0);
+    }
+  }
+
+  // Sweep over the boundaries of the ranges of the states to find the
+  // intervals of characters that are accepted by the same states.
+  ZoneVector<std::pair<uint32_t, int>> boundaries(zone);
+  for (int state = 0; state < state_count; ++state) {
+    const RegExpInstruction::Uc16Range& range =
+        bytecode[pc_of_state[state]].payload.consume_range;
+    boundaries.emplace_back(range.min, state);
+    boundaries.emplace_back(uint32_t{range.max} + 1, state);
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  ZoneVector<uint32_t> interval_starts(1, 0, zone);
+  ZoneVector<StateSet> interval_states(1, 0, zone);
+  StateSet states = 0;
+  for (size_t i = 0; i < boundaries.size(); ++i) {
+    // Every state is toggled on at its range's start and off after its end.
+    states ^= StateSet{1} << boundaries[i].second;
+    uint32_t start = boundaries[i].first;
+    if (i + 1 < boundaries.size() && boundaries[i + 1].first == start) continue;
+    if (interval_starts.back() == start) {
+      interval_states.back() = states;
+    } else {
+      interval_starts.push_back(start);
+      interval_states.push_back(states);
+    }
+  }
+  DCHECK_EQ(states, 0);
+  header.interval_count = static_cast<int32_t>(interval_starts.size());
+  ZoneVector<StateSet> one_byte_states(kOneByteCharacters, 0, zone);
+  size_t interval = 0;
+  for (uint32_t c = 0; c < kOneByteCharacters; ++c) {
+    while (interval + 1 < interval_starts.size() &&
+           interval_starts[interval + 1] <= c) {
+      ++interval;
+    }
+    one_byte_states[c] = interval_states[interval];
+  }
+
+  const int length =
+      sizeof(Header) +
+      sizeof(StateSet) * (successor_table.size() + one_byte_states.size() +
+                          interval_states.size()) +
+      sizeof(uint32_t) * interval_starts.size();
+  auto tables = base::OwnedVector<uint8_t>::NewForOverwrite(length);
+  uint8_t* cursor = tables.begin();
+  auto append = [&](const void* data, size_t size) {
+    MemCopy(cursor, data, size);
+    cursor += size;
+  };
+  append(&header, sizeof(Header));
+  append(successor_table.data(), sizeof(StateSet) * successor_table.size());
+  append(one_byte_states.data(), sizeof(StateSet) * one_byte_states.size());
+  append(interval_states.data(), sizeof(StateSet) * interval_states.size());
+  append(interval_starts.data(), sizeof(uint32_t) * interval_starts.size());
+  DCHECK_EQ(cursor, tables.end());
+  return std::make_unique<ExperimentalRegExpBitParallelNfa>(std::move(tables));
+}
+
+ExperimentalRegExpBitParallelNfa::ExperimentalRegExpBitParallelNfa(
+    base::OwnedVector<uint8_t> tables)
+    : tables_(std::move(tables)) {
+  const uint8_t* cursor = tables_.begin();
+  MemCopy(&header_, cursor, sizeof(Header));
+  cursor += sizeof(Header);
+  successors_ = cursor;
+  cursor += sizeof(StateSet) * header_.chunk_count * kChunkValues;
+  one_byte_states_ = cursor;
+  cursor += sizeof(StateSet) * kOneByteCharacters;
+  interval_states_ = cursor;
+  cursor += sizeof(StateSet) * header_.interval_count;
+  interval_starts_ = cursor;
+  cursor += sizeof(uint32_t) * header_.interval_count;
+  DCHECK_EQ(cursor, tables_.end());
+}
+
+ExperimentalRegExpBitParallelNfa::StateSet
+ExperimentalRegExpBitParallelNfa::StatesAccepting(base::uc16 c) const {
+  if (c < kOneByteCharacters) return Load<StateSet>(one_byte_states_, c);
+  // Find the last interval that starts at or before `c`. The first interval
+  // starts at 0.
+  int low = 0;
+  int high = header_.interval_count;
+  while (high - low > 1) {
+    int middle = low + (high - low) / 2;
+    if (Load<uint32_t>(interval_starts_, middle) <= c) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return Load<StateSet>(interval_states_, low);
+}
+
+ExperimentalRegExpBitParallelNfa::StateSet
+ExperimentalRegExpBitParallelNfa::Step(StateSet states) const {
+  StateSet result = 0;
+  while (states != 0) {
+    int chunk =
+        base::bits::CountTrailingZerosNonZero(states) / kStatesPerChunk;
+    int shift = chunk * kStatesPerChunk;
+    StateSet subset = (states >> shift) & (kChunkValues - 1);
+    result |= Load<StateSet>(successors_,
+                             chunk * kChunkValues + static_cast<int>(subset));
+    states &= ~(StateSet{kChunkValues - 1} << shift);
+  }
+  return result;
+}
+
+template <class Character>
+bool ExperimentalRegExpBitParallelNfa::MayMatch(
+    base::Vector<const Character> input, int start_index) const {
+  DCHECK_LE(0, start_index);
+  DCHECK_LE(start_index, input.length());
+  StateSet states = header_.initial_states;
+  for (int i = start_index;; ++i) {
+    if (states & kAccept) return true;
+    if (states == 0 || i == input.length()) return false;
+    states = Step(states & StatesAccepting(input[i]));
+  }
+}
+
+template bool ExperimentalRegExpBitParallelNfa::MayMatch(
+    base::Vector<const uint8_t> input, int start_index) const;
+template bool ExperimentalRegExpBitParallelNfa::MayMatch(
+    base::Vector<const base::uc16> input, int start_index) const;
+
+const ExperimentalRegExpBitParallelNfa*
+ExperimentalRegExpBitParallelNfaCache::Lookup(
+    Tagged<TrustedByteArray> bytecode, Zone* zone) {
+  auto it = entries_.find(bytecode.ptr());
+  if (it != entries_.end()) return it->second.get();
+  if (entries_.size() == kMaxEntries) entries_.clear();
+  int length = bytecode->length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * length, bytecode->length());
+  base::Vector<const RegExpInstruction> instructions(
+      reinterpret_cast<const RegExpInstruction*>(bytecode->begin()), length);
+  std::unique_ptr<ExperimentalRegExpBitParallelNfa> nfa =
+      ExperimentalRegExpBitParallelNfa::TryCreate(instructions, zone);
+  const ExperimentalRegExpBitParallelNfa* result = nfa.get();
+  entries_.emplace(bytecode.ptr(), std::move(nfa));
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,122 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BIT_PARALLEL_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BIT_PARALLEL_H_
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "src/base/memory.h"
+#include "src/base/vector.h"
+#include "src/objects/tagged.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+
+namespace v8 {
+namespace internal {
+
+class TrustedByteArray;
+class Zone;
+
+// A bit-parallel simulation of the NFA described by a small experimental
+// bytecode program.  The states of the NFA are the CONSUME_RANGE instructions
+// of the program, and the set of states that the interpreter's threads are
+// blocked on is represented as a single 64-bit word.  When the simulation is
+// created, the epsilon closure of every state's successor is precomputed, as
+// well as the set of states that accept each character, so that a step of the
+// simulation takes a constant number of table lookups, independent of how many
+// threads are active.
+//
+// The simulation ignores everything that only restricts which threads
+// survive: thread priorities, assertions, lookbehinds and the rule that
+// quantifier iterations must not match the empty string.  The simulated NFA
+// thus matches a superset of the inputs that the program matches, so the
+// simulation can only tell that the program certainly does not match.  That
+// is where the interpreter spends most of its time when scanning a long
+// subject for a match that isn't there, and the interpreter still computes
+// the boundaries and captures of matches that exist.
+class ExperimentalRegExpBitParallelNfa final {
+ public:
+  // Computes the tables for `bytecode`.  Returns nullptr if the program has
+  // too many states.
+  static std::unique_ptr<ExperimentalRegExpBitParallelNfa> TryCreate(
+      base::Vector<const RegExpInstruction> bytecode, Zone* zone);
+
+  explicit ExperimentalRegExpBitParallelNfa(base::OwnedVector<uint8_t> tables);
+
+  // Returns false if the program certainly doesn't match `input` at or after
+  // `start_index`.
+  template <class Character>
+  bool MayMatch(base::Vector<const Character> input, int start_index) const;
+
+ private:
+  using StateSet = uint64_t;
+  // The last bit of a state set stands for the ACCEPT instruction.
+  static constexpr int kMaxStateCount = 63;
+  static constexpr StateSet kAccept = StateSet{1} << kMaxStateCount;
+  static constexpr int kStatesPerChunk = 8;
+  static constexpr int kChunkValues = 1 << kStatesPerChunk;
+  static constexpr int kOneByteCharacters = 256;
+
+  // The tables start with a header, which is followed by
+  //   - for each chunk of 8 states and each subset of the chunk, the union of
+  //     the epsilon closures of the successors of the states in the subset,
+  //   - the states that accept each one-byte character, and
+  //   - the states that accept each interval of characters that are accepted
+  //     by the same states, followed by the intervals' first characters in
+  //     ascending order.
+  struct Header {
+    // The epsilon closure of the first instruction.
+    StateSet initial_states;
+    int32_t chunk_count;
+    int32_t interval_count;
+  };
+
+  // The states that accept `c`.
+  StateSet StatesAccepting(base::uc16 c) const;
+  // The union of the successor closures of `states`.
+  StateSet Step(StateSet states) const;
+
+  template <typename T>
+  static T Load(const uint8_t* table, int index) {
+    return base::ReadUnalignedValue<T>(
+        reinterpret_cast<Address>(table + index * sizeof(T)));
+  }
+
+  base::OwnedVector<uint8_t> tables_;
+  Header header_;
+  const uint8_t* successors_;
+  const uint8_t* one_byte_states_;
+  const uint8_t* interval_states_;
+  const uint8_t* interval_starts_;
+};
+
+// The simulations of the bytecode programs that the isolate's experimental
+// regexps ran with --experimental-regexp-engine-bit-parallel.  The tables live
+// off-heap so that regexps don't pay for them without the flag.  Entries are
+// keyed by the address of the bytecode, so the heap clears the cache before
+// every full GC, which may move or free the bytecode.
+class ExperimentalRegExpBitParallelNfaCache final {
+ public:
+  // Returns the simulation of `bytecode`, or nullptr if the program has too
+  // many states.
+  const ExperimentalRegExpBitParallelNfa* Lookup(
+      Tagged<TrustedByteArray> bytecode, Zone* zone);
+
+  void Clear() { entries_.clear(); }
+
+ private:
+  // Regexps beyond this many start over with an empty cache.
+  static constexpr size_t kMaxEntries = 64;
+
+  std::unordered_map<Address,
+                     std::unique_ptr<ExperimentalRegExpBitParallelNfa>>
+      entries_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BIT_PARALLEL_H_
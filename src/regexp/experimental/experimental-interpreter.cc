@@ -12,6 +12,8 @@
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-bit-parallel.h"
+#include "src/regexp/experimental/experimental-lazy-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -278,7 +280,7 @@ class NfaInterpreter {
   NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
                  Tagged<TrustedByteArray> bytecode,
                  int register_count_per_match, Tagged<String> input,
-                 int32_t input_index, Zone* zone)
+                 int32_t input_index, size_t dfa_memory_usage, Zone* zone)
       : isolate_(isolate),
         call_origin_(call_origin),
         bytecode_object_(bytecode),
@@ -301,6 +303,7 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        dfa_memory_usage_(dfa_memory_usage),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -815,10 +818,11 @@ class NfaInterpreter {
     DCHECK(v8_flags.experimental_regexp_engine_capture_group_opt);
 
     // Copmputes an approximation of the total current memory usage of the
-    // intepreter. It is based only on the threads' consumption, since the rest
-    // is negligible in comparison.
+    // intepreter. It is based only on the threads' consumption and the lazy
+    // DFA's cache, since the rest is negligible in comparison.
     uint64_t approx = (blocked_threads_.length() + active_threads_.length()) *
-                      memory_consumption_per_thread_;
+                          memory_consumption_per_thread_ +
+                      dfa_memory_usage_;
 
     return (approx <
             v8_flags.experimental_regexp_engine_capture_group_opt_max_memory_usage *
@@ -1091,11 +1095,87 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // The memory that the lazy DFA used to find where to start, which counts
+  // towards the same limit as the threads.
+  const size_t dfa_memory_usage_;
+
   Zone* zone_;
 };
 
 }  // namespace
 
+namespace {
+
+// Inputs shorter than this are left to the interpreter alone, since running
+// the bit-parallel simulation or the lazy DFA first would not pay off.
+constexpr int kMinInputLengthForAutomata = 64;
+
+// Uses the bit-parallel simulation of the program's NFA, whose tables are
+// cached on the isolate, to rule out inputs on which the program doesn't
+// match.
+bool MayMatch(Isolate* isolate, Tagged<TrustedByteArray> bytecode,
+              Tagged<String> input, int start_index, Zone* zone,
+              const DisallowGarbageCollection& no_gc) {
+  if (!v8_flags.experimental_regexp_engine_bit_parallel ||
+      input->length() - start_index < kMinInputLengthForAutomata) {
+    return true;
+  }
+  const ExperimentalRegExpBitParallelNfa* nfa =
+      isolate->regexp_bit_parallel_nfa_cache()->Lookup(bytecode, zone);
+  if (nfa == nullptr) return true;
+  String::FlatContent content = input->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return nfa->MayMatch(content.ToOneByteVector(), start_index);
+  }
+  return nfa->MayMatch(content.ToUC16Vector(), start_index);
+}
+
+// Uses the lazy DFA to find out whether the program matches and, if so, where
+// the first match starts, so that the interpreter can skip the input before
+// it.  Returns whether there is a match, or nothing if the DFA didn't run or
+// ran out of memory.  `*start_index` is advanced to the position to start the
+// interpreter at, and `*memory_usage` is set to the memory that the DFA used.
+std::optional<bool> FindFirstMatchStart(Tagged<TrustedByteArray> bytecode,
+                                        Tagged<String> input, int* start_index,
+                                        Zone* zone,
+                                        const DisallowGarbageCollection& no_gc,
+                                        size_t* memory_usage) {
+  *memory_usage = 0;
+  if (!v8_flags.experimental_regexp_engine_lazy_dfa ||
+      input->length() - *start_index < kMinInputLengthForAutomata) {
+    return std::nullopt;
+  }
+  const size_t max_memory_usage =
+      std::min<uint64_t>(
+          v8_flags.experimental_regexp_engine_lazy_dfa_max_memory_usage,
+          v8_flags.experimental_regexp_engine_capture_group_opt_max_memory_usage) *
+      MB;
+  ExperimentalRegExpLazyDfa* dfa = ExperimentalRegExpLazyDfa::TryCreate(
+      ToInstructionVector(bytecode, no_gc), max_memory_usage, zone);
+  if (dfa == nullptr) return std::nullopt;
+  String::FlatContent content = input->GetFlatContent(no_gc);
+  int match_start;
+  ExperimentalRegExpLazyDfa::Result result =
+      content.IsOneByte()
+          ? dfa->FindMatchStart(content.ToOneByteVector(), *start_index,
+                                &match_start)
+          : dfa->FindMatchStart(content.ToUC16Vector(), *start_index,
+                                &match_start);
+  *memory_usage = dfa->memory_usage();
+  switch (result) {
+    case ExperimentalRegExpLazyDfa::Result::kNoMatch:
+      return false;
+    case ExperimentalRegExpLazyDfa::Result::kMatch:
+      *start_index = match_start;
+      return true;
+    case ExperimentalRegExpLazyDfa::Result::kOutOfMemory:
+      return std::nullopt;
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
 int ExperimentalRegExpInterpreter::FindMatches(
     Isolate* isolate, RegExp::CallOrigin call_origin,
     Tagged<TrustedByteArray> bytecode, int register_count_per_match,
@@ -1104,16 +1184,26 @@ int ExperimentalRegExpInterpreter::FindMatches(
   DCHECK(input->IsFlat());
   DisallowGarbageCollection no_gc;
 
+  size_t dfa_memory_usage;
+  std::optional<bool> has_match = FindFirstMatchStart(
+      bytecode, input, &start_index, zone, no_gc, &dfa_memory_usage);
+  if (!has_match.has_value()) {
+    // Without a verdict of the DFA, the prefilter may still rule out a match.
+    has_match = MayMatch(isolate, bytecode, input, start_index, zone, no_gc);
+  }
+  if (!*has_match) return 0;
+
   if (input->GetFlatContent(no_gc).IsOneByte()) {
     NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
                                         register_count_per_match, input,
-                                        start_index, zone);
+                                        start_index, dfa_memory_usage, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   } else {
     DCHECK(input->GetFlatContent(no_gc).IsTwoByte());
     NfaInterpreter<base::uc16> interpreter(isolate, call_origin, bytecode,
                                            register_count_per_match, input,
-                                           start_index, zone);
+                                           start_index, dfa_memory_usage,
+                                           zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   }
 }
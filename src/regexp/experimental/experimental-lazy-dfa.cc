@@ -0,0 +1,374 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-lazy-dfa.h"
+
+#include <algorithm>
+
+#include "src/sandbox/check.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// A rough estimate of the size of an entry of the state table, in addition to
+// its key.
+constexpr size_t kStateOverhead = 8 * sizeof(void*);
+
+bool InRange(const RegExpInstruction& inst, base::uc16 c) {
+  DCHECK_EQ(inst.opcode, RegExpInstruction::CONSUME_RANGE);
+  return inst.payload.consume_range.min <= c &&
+         c <= inst.payload.consume_range.max;
+}
+
+}  // namespace
+
+ExperimentalRegExpLazyDfa::ExperimentalRegExpLazyDfa(
+    base::Vector<const RegExpInstruction> bytecode, size_t max_memory_usage,
+    Zone* zone)
+    : bytecode_(bytecode),
+      max_memory_usage_(max_memory_usage),
+      zone_(zone),
+      class_boundaries_(zone),
+      one_byte_classes_(zone),
+      states_(zone),
+      state_ids_(zone),
+      stack_(zone),
+      next_threads_(zone),
+      processed_(2 * bytecode.length(), 0, zone),
+      main_states_(zone),
+      state_index_of_pc_(zone),
+      predecessors_(zone),
+      initial_(zone),
+      final_states_(zone),
+      backwards_current_(zone),
+      backwards_next_(zone) {}
+
+// static
+ExperimentalRegExpLazyDfa* ExperimentalRegExpLazyDfa::TryCreate(
+    base::Vector<const RegExpInstruction> bytecode, size_t max_memory_usage,
+    Zone* zone) {
+  int main_pc = -1;
+  for (int pc = 0; pc < bytecode.length(); ++pc) {
+    const RegExpInstruction& inst = bytecode[pc];
+    // Whether threads survive these depends on more than the state.
+    if (inst.opcode == RegExpInstruction::ASSERTION ||
+        inst.opcode == RegExpInstruction::READ_LOOKBEHIND_TABLE) {
+      return nullptr;
+    }
+    if (main_pc == -1 &&
+        inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP &&
+        inst.payload.register_index == 0) {
+      main_pc = pc;
+    }
+  }
+  if (main_pc == -1) return nullptr;
+
+  auto* dfa =
+      zone->New<ExperimentalRegExpLazyDfa>(bytecode, max_memory_usage, zone);
+  dfa->main_pc_ = main_pc;
+  for (const RegExpInstruction& inst : bytecode) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    dfa->class_boundaries_.push_back(inst.payload.consume_range.min);
+    dfa->class_boundaries_.push_back(
+        uint32_t{inst.payload.consume_range.max} + 1);
+  }
+  std::sort(dfa->class_boundaries_.begin(), dfa->class_boundaries_.end());
+  dfa->class_boundaries_.erase(std::unique(dfa->class_boundaries_.begin(),
+                                           dfa->class_boundaries_.end()),
+                               dfa->class_boundaries_.end());
+  dfa->one_byte_classes_.resize(kMaxUInt8 + 1);
+  int character_class = 0;
+  for (uint32_t c = 0; c <= kMaxUInt8; ++c) {
+    while (character_class <
+               static_cast<int>(dfa->class_boundaries_.size()) &&
+           dfa->class_boundaries_[character_class] <= c) {
+      ++character_class;
+    }
+    dfa->one_byte_classes_[c] = character_class;
+  }
+  return dfa;
+}
+
+int ExperimentalRegExpLazyDfa::CharacterClass(base::uc16 c) const {
+  if (c <= kMaxUInt8) return one_byte_classes_[c];
+  return static_cast<int>(std::upper_bound(class_boundaries_.begin(),
+                                           class_boundaries_.end(),
+                                           uint32_t{c}) -
+                          class_boundaries_.begin());
+}
+
+int ExperimentalRegExpLazyDfa::StartState() {
+  if (start_state_ == kUnknownState) {
+    ++step_;
+    stack_.clear();
+    // The interpreter starts with a single thread at pc 0, which counts as
+    // having consumed a character.
+    stack_.push_back(EncodeThread(0, true));
+    start_state_ = RunThreads();
+  }
+  return start_state_;
+}
+
+int ExperimentalRegExpLazyDfa::NextState(int from, base::uc16 c) {
+  const int character_class = CharacterClass(c);
+  int next = states_[from].transitions[character_class];
+  if (next != kUnknownState) return next;
+
+  ++step_;
+  stack_.clear();
+  // Push the threads that consume `c` such that the one with the highest
+  // priority runs first.
+  base::Vector<const uint32_t> threads = states_[from].threads;
+  for (int i = threads.length() - 1; i >= 0; --i) {
+    int pc = ThreadPc(threads[i]);
+    if (InRange(bytecode_[pc], c)) stack_.push_back(EncodeThread(pc + 1, true));
+  }
+  next = RunThreads();
+  if (next != kNoState) states_[from].transitions[character_class] = next;
+  return next;
+}
+
+int ExperimentalRegExpLazyDfa::RunThreads() {
+  // The first element of the key is whether the state is accepting.
+  next_threads_.assign(1, 0);
+  bool accepting = false;
+  while (!stack_.empty()) {
+    uint32_t thread = stack_.back();
+    stack_.pop_back();
+    if (RunThread(thread)) {
+      // Threads with lower priority than an accepting one are discarded.
+      accepting = true;
+      stack_.clear();
+    }
+  }
+  next_threads_[0] = accepting;
+  return InternState(accepting);
+}
+
+bool ExperimentalRegExpLazyDfa::RunThread(uint32_t thread) {
+  int pc = ThreadPc(thread);
+  bool consumed = ThreadConsumed(thread);
+  while (true) {
+    SBXCHECK_BOUNDS(pc, bytecode_.size());
+    // Like the interpreter, only run the first thread that reaches a pc in a
+    // step.
+    uint32_t key = EncodeThread(pc, consumed);
+    if (processed_[key] == step_) return false;
+    processed_[key] = step_;
+
+    const RegExpInstruction& inst = bytecode_[pc];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE:
+        next_threads_.push_back(key);
+        return false;
+      case RegExpInstruction::FORK:
+        stack_.push_back(EncodeThread(inst.payload.pc, consumed));
+        ++pc;
+        break;
+      case RegExpInstruction::JMP:
+        pc = inst.payload.pc;
+        break;
+      case RegExpInstruction::ACCEPT:
+        return true;
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        ++pc;
+        break;
+      case RegExpInstruction::BEGIN_LOOP:
+        consumed = false;
+        ++pc;
+        break;
+      case RegExpInstruction::END_LOOP:
+        if (!consumed) return false;
+        ++pc;
+        break;
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::FILTER_QUANTIFIER:
+      case RegExpInstruction::FILTER_GROUP:
+      case RegExpInstruction::FILTER_CHILD:
+        UNREACHABLE();
+    }
+  }
+}
+
+int ExperimentalRegExpLazyDfa::InternState(bool accepting) {
+  base::Vector<const uint32_t> key(next_threads_.data(), next_threads_.size());
+  auto it = state_ids_.find(key);
+  if (it != state_ids_.end()) return it->second;
+
+  const size_t class_count = class_boundaries_.size() + 1;
+  if (!Allocate(key.length() * sizeof(uint32_t) + class_count * sizeof(int) +
+                sizeof(State) + kStateOverhead)) {
+    return kNoState;
+  }
+  uint32_t* stored_key = zone_->AllocateArray<uint32_t>(key.length());
+  std::copy(key.begin(), key.end(), stored_key);
+  int* transitions = zone_->AllocateArray<int>(class_count);
+  std::fill(transitions, transitions + class_count, kUnknownState);
+
+  int id = static_cast<int>(states_.size());
+  states_.push_back(
+      {base::Vector<const uint32_t>(stored_key + 1, key.length() - 1),
+       accepting, transitions});
+  state_ids_.emplace(base::Vector<const uint32_t>(stored_key, key.length()),
+                     id);
+  return id;
+}
+
+bool ExperimentalRegExpLazyDfa::Closure(int start_pc) {
+  ++step_;
+  stack_.assign(1, start_pc);
+  next_threads_.clear();
+  bool accepts = false;
+  while (!stack_.empty()) {
+    int pc = stack_.back();
+    stack_.pop_back();
+    SBXCHECK_BOUNDS(pc, bytecode_.size());
+    if (processed_[pc] == step_) continue;
+    processed_[pc] = step_;
+    const RegExpInstruction& inst = bytecode_[pc];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE:
+        next_threads_.push_back(pc);
+        break;
+      case RegExpInstruction::ACCEPT:
+        accepts = true;
+        break;
+      case RegExpInstruction::FORK:
+        stack_.push_back(inst.payload.pc);
+        stack_.push_back(pc + 1);
+        break;
+      case RegExpInstruction::JMP:
+        stack_.push_back(inst.payload.pc);
+        break;
+      default:
+        // Everything else falls through to the next instruction; skipping
+        // empty quantifier iterations only restricts the paths through the
+        // program, not the inputs it matches.
+        stack_.push_back(pc + 1);
+        break;
+    }
+  }
+  return accepts;
+}
+
+bool ExperimentalRegExpLazyDfa::InitializeBackwards() {
+  DCHECK(!backwards_initialized_);
+  backwards_initialized_ = true;
+  state_index_of_pc_.assign(bytecode_.length(), -1);
+
+  // Numbers the CONSUME_RANGE instructions in `next_threads_` that don't have
+  // a number yet.
+  auto add_states = [&]() {
+    for (uint32_t pc : next_threads_) {
+      if (state_index_of_pc_[pc] >= 0) continue;
+      if (!Allocate(sizeof(int) + sizeof(ZoneVector<int>) + sizeof(bool))) {
+        return false;
+      }
+      state_index_of_pc_[pc] = static_cast<int>(main_states_.size());
+      main_states_.push_back(pc);
+      predecessors_.emplace_back(zone_);
+      initial_.push_back(false);
+    }
+    return true;
+  };
+
+  matches_empty_ = Closure(main_pc_);
+  if (!add_states()) return false;
+  for (uint32_t pc : next_threads_) initial_[state_index_of_pc_[pc]] = true;
+
+  for (size_t i = 0; i < main_states_.size(); ++i) {
+    if (Closure(main_states_[i] + 1)) {
+      final_states_.push_back(static_cast<int>(i));
+    }
+    if (!add_states()) return false;
+    if (!Allocate(next_threads_.size() * sizeof(int))) return false;
+    for (uint32_t pc : next_threads_) {
+      predecessors_[state_index_of_pc_[pc]].push_back(static_cast<int>(i));
+    }
+  }
+  backwards_available_ = true;
+  return true;
+}
+
+template <class Character>
+int ExperimentalRegExpLazyDfa::FindStartBackwards(
+    base::Vector<const Character> input, int start_index, int match_end) {
+  if (!backwards_initialized_) InitializeBackwards();
+  if (!backwards_available_) return start_index;
+
+  // Walk backwards from the end of the match, tracking the set of states from
+  // which the rest of the match can be consumed, and remember the last
+  // position at which the main expression could have started.
+  int match_start = matches_empty_ ? match_end : -1;
+  backwards_current_.clear();
+  for (int i = match_end - 1; i >= start_index; --i) {
+    const base::uc16 c = input[i];
+    ++step_;
+    backwards_next_.clear();
+    auto add = [&](int state) {
+      if (processed_[state] == step_) return;
+      if (!InRange(bytecode_[main_states_[state]], c)) return;
+      processed_[state] = step_;
+      backwards_next_.push_back(state);
+      if (initial_[state]) match_start = i;
+    };
+    if (i == match_end - 1) {
+      for (int state : final_states_) add(state);
+    } else {
+      for (int state : backwards_current_) {
+        for (int predecessor : predecessors_[state]) add(predecessor);
+      }
+    }
+    if (backwards_next_.empty()) break;
+    std::swap(backwards_current_, backwards_next_);
+  }
+  return match_start >= 0 ? match_start : start_index;
+}
+
+template <class Character>
+ExperimentalRegExpLazyDfa::Result ExperimentalRegExpLazyDfa::FindMatchStart(
+    base::Vector<const Character> input, int start_index, int* match_start) {
+  DCHECK_LE(0, start_index);
+  DCHECK_LE(start_index, input.length());
+  int state = StartState();
+  if (state == kNoState) return Result::kOutOfMemory;
+
+  // Run until the input is exhausted or no thread is left, as the interpreter
+  // does, and remember where the last accepting step ended.
+  int match_end = states_[state].accepting ? start_index : -1;
+  for (int i = start_index; i < input.length();) {
+    if (states_[state].threads.empty()) break;
+    state = NextState(state, input[i++]);
+    if (state == kNoState) return Result::kOutOfMemory;
+    if (states_[state].accepting) match_end = i;
+  }
+  if (match_end < 0) return Result::kNoMatch;
+
+  *match_start = FindStartBackwards(input, start_index, match_end);
+  DCHECK_LE(start_index, *match_start);
+  DCHECK_LE(*match_start, match_end);
+  return Result::kMatch;
+}
+
+template ExperimentalRegExpLazyDfa::Result
+ExperimentalRegExpLazyDfa::FindMatchStart(base::Vector<const uint8_t> input,
+                                          int start_index, int* match_start);
+template ExperimentalRegExpLazyDfa::Result
+ExperimentalRegExpLazyDfa::FindMatchStart(base::Vector<const base::uc16> input,
+                                          int start_index, int* match_start);
+
+bool ExperimentalRegExpLazyDfa::Allocate(size_t bytes) {
+  if (memory_usage_ + bytes > max_memory_usage_) return false;
+  memory_usage_ += bytes;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
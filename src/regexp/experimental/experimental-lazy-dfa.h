@@ -0,0 +1,163 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_LAZY_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_LAZY_DFA_H_
+
+#include <cstdint>
+
+#include "src/base/functional.h"
+#include "src/base/vector.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+// A DFA for an experimental bytecode program that is built lazily while it
+// runs over an input, so that only the states and transitions the input
+// actually needs are ever computed.
+//
+// A state of the DFA is the priority-ordered list of the program counters of
+// the interpreter's threads that are blocked on a CONSUME_RANGE instruction,
+// together with whether each of them consumed a character since its last
+// quantifier iteration started.  For programs without assertions and
+// lookbehinds, that is all that determines how the interpreter's threads
+// evolve, so a transition of the DFA computes exactly what a step of the
+// interpreter does, except for the capture registers.  The DFA thus finds
+// where the interpreter's first match ends without tracking captures, and a
+// backwards simulation of the NFA from there finds where the match starts.
+// The interpreter then only needs to run from that position to compute the
+// captures, and doesn't need to run at all if there is no match.
+//
+// The states and transitions are cached in the DFA's zone, up to a memory
+// budget.  Once the budget is exhausted the DFA gives up, and the interpreter
+// runs as if there was no DFA.
+//
+// The DFA refers to the bytecode, so it must not be used across a GC.
+class ExperimentalRegExpLazyDfa final : public ZoneObject {
+ public:
+  enum class Result { kNoMatch, kMatch, kOutOfMemory };
+
+  // Returns nullptr if the program has assertions or lookbehinds.
+  static ExperimentalRegExpLazyDfa* TryCreate(
+      base::Vector<const RegExpInstruction> bytecode, size_t max_memory_usage,
+      Zone* zone);
+
+  // Finds the first match in `input` at or after `start_index`.  If there is
+  // one, returns kMatch and sets `*match_start` to a position at or after
+  // `start_index` such that the match starts at or after `*match_start`.
+  template <class Character>
+  Result FindMatchStart(base::Vector<const Character> input, int start_index,
+                        int* match_start);
+
+  // The number of bytes that the DFA allocated in its zone.
+  size_t memory_usage() const { return memory_usage_; }
+
+ private:
+  friend class Zone;
+
+  static constexpr int kNoState = -1;
+  static constexpr int kUnknownState = -2;
+
+  struct State {
+    // The encoded blocked threads, from high to low priority.
+    base::Vector<const uint32_t> threads;
+    // Whether a thread executed ACCEPT in the step that led to the state.
+    bool accepting;
+    // The state after each character class, or kUnknownState.
+    int* transitions;
+  };
+
+  struct KeyHash {
+    size_t operator()(base::Vector<const uint32_t> key) const {
+      return base::hash_range(key.begin(), key.end());
+    }
+  };
+
+  ExperimentalRegExpLazyDfa(base::Vector<const RegExpInstruction> bytecode,
+                            size_t max_memory_usage, Zone* zone);
+
+  static uint32_t EncodeThread(int pc, bool consumed) {
+    return static_cast<uint32_t>(pc) << 1 | (consumed ? 1 : 0);
+  }
+  static int ThreadPc(uint32_t thread) { return thread >> 1; }
+  static bool ThreadConsumed(uint32_t thread) { return thread & 1; }
+
+  int CharacterClass(base::uc16 c) const;
+
+  // The state that the interpreter starts with, or kNoState if the memory
+  // budget is exhausted.
+  int StartState();
+  // The state after `from` consumes `c`, or kNoState if the memory budget is
+  // exhausted.
+  int NextState(int from, base::uc16 c);
+  // Runs the threads in `stack_` until they block or accept, and returns the
+  // resulting state.
+  int RunThreads();
+  // Runs a thread until it blocks, dies or accepts.  Returns whether it
+  // accepted.
+  bool RunThread(uint32_t thread);
+  // Finds or adds the state with the threads in `next_threads_`.
+  int InternState(bool accepting);
+
+  // Computes the states that the backwards simulation works on.  Returns
+  // false if the memory budget is exhausted.
+  bool InitializeBackwards();
+  // Collects the CONSUME_RANGE instructions that a thread at `pc` reaches
+  // without consuming input into `next_threads_`, ignoring the order of the
+  // threads, and returns whether it can reach ACCEPT.
+  bool Closure(int pc);
+  // Returns the smallest position at or after `start_index` at which a match
+  // that ends at `match_end` can start.
+  template <class Character>
+  int FindStartBackwards(base::Vector<const Character> input, int start_index,
+                         int match_end);
+
+  bool Allocate(size_t bytes);
+
+  const base::Vector<const RegExpInstruction> bytecode_;
+  const size_t max_memory_usage_;
+  size_t memory_usage_ = 0;
+  Zone* const zone_;
+
+  // The character classes are the intervals between consecutive boundaries,
+  // which are the characters at which some CONSUME_RANGE's range begins or
+  // ends.
+  ZoneVector<uint32_t> class_boundaries_;
+  ZoneVector<uint16_t> one_byte_classes_;
+
+  ZoneVector<State> states_;
+  ZoneUnorderedMap<base::Vector<const uint32_t>, int, KeyHash> state_ids_;
+  int start_state_ = kUnknownState;
+
+  // Scratch space for computing transitions.
+  ZoneVector<uint32_t> stack_;
+  ZoneVector<uint32_t> next_threads_;
+  ZoneVector<uint32_t> processed_;
+  uint32_t step_ = 0;
+
+  // The program counter of the main expression's first instruction, after the
+  // /.*?/ preamble of unanchored programs.
+  int main_pc_ = 0;
+  // For the backwards simulation: the CONSUME_RANGE instructions of the main
+  // expression, the instructions from which each of them can be reached after
+  // consuming a character, and whether the main expression can start at or
+  // end after each of them.
+  bool backwards_initialized_ = false;
+  bool backwards_available_ = false;
+  ZoneVector<int> main_states_;
+  ZoneVector<int> state_index_of_pc_;
+  ZoneVector<ZoneVector<int>> predecessors_;
+  ZoneVector<bool> initial_;
+  ZoneVector<int> final_states_;
+  bool matches_empty_ = false;
+  ZoneVector<int> backwards_current_;
+  ZoneVector<int> backwards_next_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_LAZY_DFA_H_
@@ -4058,4 +4058,208 @@ void RegExpCompiler::ToNodeCheckForStackOverflow() {
   }
 }
 
+namespace {
+
+// Computes, bottom-up, which strings the matches of each node of a regexp
+// tree are known to contain. Strings are kept as long as
+// kMaxRequiredLiteralLength characters at most.
+class RequiredLiteralVisitor final : private RegExpVisitor {
+ public:
+  using Literal = base::Vector<const base::uc16>;
+
+  struct Info {
+    // The length of all matches of the node, or -1 if it varies.
+    int length;
+    // Whether every match of the node is exactly `prefix`, which is then
+    // also `suffix` and `best`.
+    bool exact;
+    // Strings that every match of the node starts and ends with.
+    Literal prefix;
+    Literal suffix;
+    // The longest string that every match of the node contains, and its
+    // offset from the start of the match, or -1 if that varies.
+    Literal best;
+    int best_offset;
+  };
+
+  RequiredLiteralVisitor(RegExpFlags flags, Zone* zone)
+      : flags_(flags), zone_(zone) {}
+
+  Info Visit(RegExpTree* node) {
+    if (depth_ >= RegExpCompiler::kMaxRecursion) return Opaque(-1);
+    ++depth_;
+    Info info = *static_cast<Info*>(node->Accept(this, nullptr));
+    --depth_;
+    return info;
+  }
+
+ private:
+  static Info Exact(Literal literal) {
+    return {literal.length(), true, literal, literal, literal, 0};
+  }
+  static Info Opaque(int length) {
+    return {length, false, Literal(), Literal(), Literal(), -1};
+  }
+  void* New(const Info& info) { return zone_->New<Info>(info); }
+
+  // Concatenates `a` and `b`, keeping the first or last characters if the
+  // result is too long.
+  Literal Concat(Literal a, Literal b, bool keep_head) {
+    if (a.empty()) return b;
+    if (b.empty()) return a;
+    const int length = std::min(a.length() + b.length(),
+                                RegExpCompiler::kMaxRequiredLiteralLength);
+    base::Vector<base::uc16> result = zone_->AllocateVector<base::uc16>(length);
+    int skip = keep_head ? 0 : a.length() + b.length() - length;
+    for (int i = 0; i < length; ++i) {
+      int j = i + skip;
+      result[i] = j < a.length() ? a[j] : b[j - a.length()];
+    }
+    return result;
+  }
+
+  // The info of `a` followed by `b`.
+  Info Sequence(const Info& a, const Info& b) {
+    const int length =
+        a.length >= 0 && b.length >= 0 ? a.length + b.length : -1;
+    if (a.exact && b.exact &&
+        a.prefix.length() + b.prefix.length() <=
+            RegExpCompiler::kMaxRequiredLiteralLength) {
+      Info result = Exact(Concat(a.prefix, b.prefix, true));
+      DCHECK_EQ(result.length, length);
+      return result;
+    }
+    Info result = Opaque(length);
+    result.prefix = a.exact ? Concat(a.prefix, b.prefix, true) : a.prefix;
+    result.suffix = b.exact ? Concat(a.suffix, b.suffix, false) : b.suffix;
+
+    // The best string is the best one of either side or the one that spans
+    // the boundary.
+    auto consider = [&](Literal literal, int offset) {
+      if (literal.length() > result.best.length() ||
+          (literal.length() == result.best.length() && offset >= 0 &&
+           result.best_offset < 0)) {
+        result.best = literal;
+        result.best_offset = offset;
+      }
+    };
+    consider(a.best, a.best_offset);
+    consider(b.best,
+             a.length >= 0 && b.best_offset >= 0 ? a.length + b.best_offset
+                                                 : -1);
+    consider(Concat(a.suffix, b.prefix, true),
+             a.length >= 0 ? a.length - a.suffix.length() : -1);
+    return result;
+  }
+
+  // A class matches a single character, except that it may match a surrogate
+  // pair in unicode mode.
+  int ClassLength() const { return IsEitherUnicode(flags_) ? -1 : 1; }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    return New(Opaque(node->min_match() == node->max_match() &&
+                              node->max_match() != RegExpTree::kInfinity
+                          ? node->min_match()
+                          : -1));
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    Info info = Exact(Literal());
+    for (RegExpTree* child : *node->nodes()) {
+      info = Sequence(info, Visit(child));
+    }
+    return New(info);
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    Info info = Exact(Literal());
+    for (const TextElement& element : *node->elements()) {
+      info = Sequence(info, element.text_type() == TextElement::ATOM
+                                ? Exact(element.atom()->data())
+                                : Opaque(ClassLength()));
+    }
+    return New(info);
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    return New(Exact(node->data()));
+  }
+
+  void* VisitClassRanges(RegExpClassRanges* node, void*) override {
+    return New(Opaque(ClassLength()));
+  }
+
+  void* VisitClassSetOperand(RegExpClassSetOperand* node, void*) override {
+    return New(Opaque(-1));
+  }
+
+  void* VisitClassSetExpression(RegExpClassSetExpression* node,
+                                void*) override {
+    return New(Opaque(-1));
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    Info body = Visit(node->body());
+    if (node->min() == 1 && node->max() == 1) return New(body);
+    if (node->min() == 0) return New(Opaque(node->max() == 0 ? 0 : -1));
+    // The first iteration starts and the last one ends the match.
+    Info info = Opaque(body.length >= 0 && node->min() == node->max() &&
+                               node->max_match() != RegExpTree::kInfinity
+                           ? node->max_match()
+                           : -1);
+    info.prefix = body.prefix;
+    info.suffix = body.suffix;
+    info.best = body.best;
+    info.best_offset = body.best_offset;
+    return New(info);
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    return New(Visit(node->body()));
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    Info body = Visit(node->body());
+    if (IsIgnoreCase(node->flags())) return New(Opaque(body.length));
+    return New(body);
+  }
+
+  // Assertions and lookarounds don't consume characters, so the characters
+  // on either side are adjacent in the match.
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    return New(Exact(Literal()));
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    return New(Exact(Literal()));
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    return New(Opaque(-1));
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override {
+    return New(Exact(Literal()));
+  }
+
+  const RegExpFlags flags_;
+  Zone* const zone_;
+  int depth_ = 0;
+};
+
+}  // namespace
+
+// static
+RegExpCompiler::RequiredLiteral RegExpCompiler::ExtractRequiredLiteral(
+    RegExpTree* tree, RegExpFlags flags, Zone* zone) {
+  RequiredLiteral result;
+  if (IsIgnoreCase(flags)) return result;
+  RequiredLiteralVisitor::Info info =
+      RequiredLiteralVisitor(flags, zone).Visit(tree);
+  if (info.best.length() < kMinRequiredLiteralLength) return result;
+  result.literal = info.best;
+  result.offset = info.best_offset;
+  return result;
+}
+
 }  // namespace v8::internal
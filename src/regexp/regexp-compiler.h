@@ -510,6 +510,26 @@ class RegExpCompiler {
   // lead surrogate and start matching from there.
   RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpNode* on_success);
 
+  // A string that every match of a regexp contains, and its distance from the
+  // start of the match.
+  struct RequiredLiteral {
+    static constexpr int kVariableOffset = -1;
+
+    bool IsEmpty() const { return literal.empty(); }
+
+    base::Vector<const base::uc16> literal;
+    int offset = kVariableOffset;
+  };
+
+  // Finds the longest string that every match of `tree` is known to contain,
+  // e.g. "@example.com" for /\w+@example\.com/, so that subjects can be
+  // searched for it before the matcher runs. Returns an empty literal if there
+  // is none of at least kMinRequiredLiteralLength characters.
+  static RequiredLiteral ExtractRequiredLiteral(RegExpTree* tree,
+                                                RegExpFlags flags, Zone* zone);
+  static constexpr int kMinRequiredLiteralLength = 2;
+  static constexpr int kMaxRequiredLiteralLength = 64;
+
   inline void AddWork(RegExpNode* node) {
     if (!node->on_work_list() && !node->label()->is_bound()) {
       node->set_on_work_list(true);
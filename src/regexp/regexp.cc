@@ -52,6 +52,13 @@ class RegExpImpl final : public AllStatic {
                              DirectHandle<IrRegExpData> regexp_data,
                              Handle<String> subject);
 
+  // Searches the subject for the regexp's required literal, see
+  // RegExp::SkipToRequiredLiteral.
+  static int SkipToRequiredLiteral(Isolate* isolate,
+                                   Tagged<IrRegExpData> regexp_data,
+                                   Tagged<String> subject, int index,
+                                   const DisallowGarbageCollection& no_gc);
+
   static void AtomCompile(Isolate* isolate, DirectHandle<JSRegExp> re,
                           DirectHandle<String> pattern, RegExpFlags flags,
                           DirectHandle<String> match_pattern);
@@ -270,6 +277,26 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
   if (!has_been_compiled) {
     RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
                                    parse_result.capture_count, backtrack_limit);
+    if (v8_flags.regexp_required_literal_prefilter) {
+      RegExpCompiler::RequiredLiteral required =
+          RegExpCompiler::ExtractRequiredLiteral(parse_result.tree, flags,
+                                                 &zone);
+      if (!required.IsEmpty()) {
+        Handle<String> literal;
+        ASSIGN_RETURN_ON_EXCEPTION(
+            isolate, literal,
+            isolate->factory()->NewStringFromTwoByte(required.literal));
+        // Matching from a later position than asked for changes the result of
+        // sticky regexps, and may start within a surrogate pair in unicode
+        // mode, so only rule out subjects there.
+        int offset = IsSticky(flags) || IsEitherUnicode(flags)
+                         ? RegExpCompiler::RequiredLiteral::kVariableOffset
+                         : required.offset;
+        Tagged<IrRegExpData> data = Cast<IrRegExpData>(re->data(isolate));
+        data->set_required_literal(*literal);
+        data->set_required_literal_offset(offset);
+      }
+    }
   }
   // Compilation succeeded so the data is set on the regexp
   // and we can store it in the cache.
@@ -643,6 +670,53 @@ int RegExpImpl::IrregexpPrepare(Isolate* isolate,
   return JSRegExp::RegistersForCaptureCount(re_data->capture_count());
 }
 
+// static
+int RegExpImpl::SkipToRequiredLiteral(Isolate* isolate,
+                                      Tagged<IrRegExpData> regexp_data,
+                                      Tagged<String> subject, int index,
+                                      const DisallowGarbageCollection& no_gc) {
+  Tagged<Object> required_literal = regexp_data->required_literal();
+  if (!IsString(required_literal) ||
+      subject->length() - index < RegExp::kMinSubjectLengthForRequiredLiteral) {
+    return index;
+  }
+  Tagged<String> needle = Cast<String>(required_literal);
+  const int offset = regexp_data->required_literal_offset();
+
+  // A match at or after `index` contains the literal at or after
+  // `index + offset`, so there is no match before the first such occurrence
+  // minus `offset`.
+  int search_index = index + std::max(offset, 0);
+  if (search_index + needle->length() > subject->length()) return -1;
+  String::FlatContent needle_content = needle->GetFlatContent(no_gc);
+  String::FlatContent subject_content = subject->GetFlatContent(no_gc);
+  DCHECK(needle_content.IsFlat());
+  DCHECK(subject_content.IsFlat());
+  int found =
+      needle_content.IsOneByte()
+          ? (subject_content.IsOneByte()
+                 ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                needle_content.ToOneByteVector(), search_index)
+                 : SearchString(isolate, subject_content.ToUC16Vector(),
+                                needle_content.ToOneByteVector(), search_index))
+          : (subject_content.IsOneByte()
+                 ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                needle_content.ToUC16Vector(), search_index)
+                 : SearchString(isolate, subject_content.ToUC16Vector(),
+                                needle_content.ToUC16Vector(), search_index));
+  if (found == -1) return -1;
+  return offset >= 0 ? found - offset : index;
+}
+
+// static
+int32_t RegExp::SkipToRequiredLiteral(Address subject, int32_t start_position,
+                                      Address regexp_data, Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  return RegExpImpl::SkipToRequiredLiteral(
+      isolate, Cast<IrRegExpData>(Tagged<Object>(regexp_data)),
+      Cast<String>(Tagged<Object>(subject)), start_position, no_gc);
+}
+
 int RegExpImpl::IrregexpExecRaw(Isolate* isolate,
                                 DirectHandle<IrRegExpData> regexp_data,
                                 Handle<String> subject, int index,
@@ -653,6 +727,10 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp_data->capture_count()));
 
+  index = SkipToRequiredLiteral(isolate, *regexp_data, *subject, index,
+                                DisallowGarbageCollection());
+  if (index == -1) return RE_FAILURE;
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp_data->ShouldProduceBytecode()) {
@@ -1061,8 +1139,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
         register_array_size_ = registers_per_match_;
         max_matches_ = 1;
       } else {
-        register_array_size_ = std::max(
-            {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+        register_array_size_ =
+            std::max({registers_per_match_,
+                      Isolate::kJSRegexpStaticOffsetsVectorSize,
+                      BatchRegisterCount()});
       }
       break;
     }
@@ -1077,8 +1157,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
       }
       registers_per_match_ = JSRegExp::RegistersForCaptureCount(
           Cast<IrRegExpData>(regexp_data_)->capture_count());
-      register_array_size_ = std::max(
-          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+      register_array_size_ =
+          std::max({registers_per_match_,
+                    Isolate::kJSRegexpStaticOffsetsVectorSize,
+                    BatchRegisterCount()});
       break;
     }
   }
@@ -1111,6 +1193,13 @@ RegExpGlobalCache::~RegExpGlobalCache() {
   }
 }
 
+int RegExpGlobalCache::BatchRegisterCount() const {
+  // Short subjects have few matches, which the static offsets vector holds
+  // just as well.
+  if (subject_->length() < kMinBatchSubjectLength) return 0;
+  return kMaxBatchRegisterCount / registers_per_match_ * registers_per_match_;
+}
+
 int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   if (IsEitherUnicode(JSRegExp::AsRegExpFlags(regexp_data_->flags())) &&
       last_index + 1 < subject_->length() &&
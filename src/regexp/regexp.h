@@ -143,6 +143,18 @@ class RegExp final : public AllStatic {
     RE_FALLBACK_TO_EXPERIMENTAL = kInternalRegExpFallbackToExperimental,
   };
 
+  // Subjects with fewer characters after the start position than this are
+  // matched without searching them for the required literal first.
+  static constexpr int kMinSubjectLengthForRequiredLiteral = 64;
+
+  // Searches `subject` for the literal that every match of the regexp contains
+  // (see IrRegExpData::required_literal), and returns the position from which
+  // to start matching, which is at or after `start_position`, or -1 if the
+  // regexp can't match. Called from generated code, so it takes raw tagged
+  // pointers.
+  static int32_t SkipToRequiredLiteral(Address subject, int32_t start_position,
+                                       Address regexp_data, Isolate* isolate);
+
   // Set last match info.  If match is nullptr, then setting captures is
   // omitted.
   static Handle<RegExpMatchInfo> SetLastMatchInfo(
@@ -195,7 +207,14 @@ class RegExpGlobalCache final {
   bool HasException() { return num_matches_ < 0; }
 
  private:
+  // Native code finds as many matches per call as fit into the register
+  // array. On long subjects, the array is made large enough for a batch of
+  // matches, up to this many registers.
+  static constexpr int kMinBatchSubjectLength = 1 * KB;
+  static constexpr int kMaxBatchRegisterCount = 2 * KB;
+
   int AdvanceZeroLength(int last_index);
+  int BatchRegisterCount() const;
 
   int num_matches_;
   int max_matches_;
@@ -641,6 +641,101 @@ StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Replaces all matches of a global regexp with a replacement that contains no
+// substitution patterns. All matches are collected first, so that the result
+// can be allocated with its final length and written directly.
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Tagged<Object>
+StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, DirectHandle<String> subject,
+    RegExpGlobalCache* global_cache, int32_t* current_match,
+    DirectHandle<String> replacement, int capture_count,
+    Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+  DCHECK_NOT_NULL(current_match);
+
+  // Start and end of each match.
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+  int64_t result_len_64 = subject_len;
+  do {
+    indices->push_back(current_match[0]);
+    indices->push_back(current_match[1]);
+    result_len_64 += replacement_len - (current_match[1] - current_match[0]);
+    current_match = global_cache->FetchNext();
+  } while (current_match != nullptr);
+
+  if (global_cache->HasException()) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+
+  RegExp::SetLastMatchInfo(isolate, last_match_info, subject, capture_count,
+                           global_cache->LastSuccessfulMatch());
+
+  // Detect integer overflow.
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    static_assert(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+  if (result_len == 0) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).empty_string();
+  }
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  if (!maybe_res.ToHandle(&untyped_res)) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  DirectHandle<ResultSeqString> result = Cast<ResultSeqString>(untyped_res);
+
+  DisallowGarbageCollection no_gc;
+  int subject_pos = 0;
+  int result_pos = 0;
+  for (size_t i = 0; i < indices->size(); i += 2) {
+    int start = (*indices)[i];
+    int end = (*indices)[i + 1];
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                          subject_pos, start - subject_pos);
+      result_pos += start - subject_pos;
+    }
+
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars(no_gc) + result_pos, 0,
+                          replacement_len);
+      result_pos += replacement_len;
+    }
+
+    subject_pos = end;
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                        subject_pos, subject_len - subject_pos);
+    result_pos += subject_len - subject_pos;
+  }
+  DCHECK_EQ(result_pos, result_len);
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 V8_WARN_UNUSED_RESULT static Tagged<Object> StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, DirectHandle<JSRegExp> regexp,
     DirectHandle<RegExpData> regexp_data, Handle<String> replacement,
@@ -684,6 +779,19 @@ V8_WARN_UNUSED_RESULT static Tagged<Object> StringReplaceGlobalRegExpWithString(
     return *subject;
   }
 
+  if (simple_replace) {
+    if (subject->IsOneByteRepresentation() &&
+        replacement->IsOneByteRepresentation()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, &global_cache, current_match, replacement,
+          capture_count, last_match_info);
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, &global_cache, current_match, replacement,
+          capture_count, last_match_info);
+    }
+  }
+
   // Guessing the number of parts that the final result string is built
   // from. Global regexps can match any number of times, so we guess
   // conservatively.
@@ -702,11 +810,7 @@ V8_WARN_UNUSED_RESULT static Tagged<Object> StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
@@ -134,6 +134,19 @@ RUNTIME_FUNCTION(Runtime_StringReplaceOneCharWithString) {
   return isolate->StackOverflow();
 }
 
+// Only called from the StringIndexOf builtin for huge ropes, which are searched
+// without flattening them.
+RUNTIME_FUNCTION(Runtime_StringIndexOf) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<String> receiver = args.at<String>(0);
+  Handle<String> search = args.at<String>(1);
+  int start_index = args.smi_value_at(2);
+  DCHECK_LE(0, start_index);
+  DCHECK_LE(start_index, receiver->length());
+  return Smi::FromInt(String::IndexOf(isolate, receiver, search, start_index));
+}
+
 RUNTIME_FUNCTION(Runtime_StringLastIndexOf) {
   HandleScope handle_scope(isolate);
   return String::LastIndexOf(isolate, args.at(0), args.at(1),
@@ -9342,8 +9342,11 @@ WasmCompilationResult ExecuteLiftoffCompilation(
   if (compiler_options.debug_sidetable) {
     debug_sidetable_builder = std::make_unique<DebugSideTableBuilder>();
   }
-  DCHECK_IMPLIES(compiler_options.max_steps,
-                 compiler_options.for_debugging == kForDebugging);
+  // The max steps counter and the nondeterminism slot are embedded as raw
+  // addresses. Code that uses them must be debug code, which is never
+  // serialized (see ShouldSerializeCode in wasm-serialization.cc).
+  CHECK_IMPLIES(compiler_options.max_steps || compiler_options.nondeterminism,
+                compiler_options.for_debugging == kForDebugging);
   WasmDetectedFeatures unused_detected_features;
 
   WasmFullDecoder<Decoder::NoValidationTag, LiftoffCompiler> decoder(
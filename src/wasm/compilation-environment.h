@@ -29,6 +29,7 @@ class Counters;
 namespace wasm {
 
 class NativeModule;
+class ProfileInformation;
 class WasmCode;
 class WasmEngine;
 class WasmError;
@@ -158,7 +159,12 @@ class V8_EXPORT_PRIVATE CompilationState {
   void AddCallback(std::unique_ptr<CompilationEventCallback> callback);
 
   void InitializeAfterDeserialization(base::Vector<const int> lazy_functions,
-                                      base::Vector<const int> eager_functions);
+                                      base::Vector<const int> eager_functions,
+                                      base::Vector<const int> liftoff_functions);
+
+  // Eagerly compile the functions that were executed or tiered up according to
+  // {pgo_info}. Compilation happens in the background.
+  void ApplyPgoInfo(ProfileInformation* pgo_info);
 
   // Set a higher priority for the compilation job.
   void SetHighPriority();
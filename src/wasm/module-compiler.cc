@@ -607,7 +607,8 @@ class CompilationStateImpl {
 
   void InitializeCompilationProgressAfterDeserialization(
       base::Vector<const int> lazy_functions,
-      base::Vector<const int> eager_functions);
+      base::Vector<const int> eager_functions,
+      base::Vector<const int> liftoff_functions);
 
   // Initializes compilation units based on the information encoded in the
   // {compilation_progress_}.
@@ -922,9 +923,14 @@ void CompilationState::AllowAnotherTopTierJobForAllFunctions() {
 
 void CompilationState::InitializeAfterDeserialization(
     base::Vector<const int> lazy_functions,
-    base::Vector<const int> eager_functions) {
+    base::Vector<const int> eager_functions,
+    base::Vector<const int> liftoff_functions) {
   Impl(this)->InitializeCompilationProgressAfterDeserialization(
-      lazy_functions, eager_functions);
+      lazy_functions, eager_functions, liftoff_functions);
+}
+
+void CompilationState::ApplyPgoInfo(ProfileInformation* pgo_info) {
+  Impl(this)->ApplyPgoInfoLate(pgo_info);
 }
 
 bool CompilationState::failed() const { return Impl(this)->failed(); }
@@ -3739,6 +3745,9 @@ void CompilationStateImpl::ApplyPgoInfoLate(ProfileInformation* pgo_info) {
   CompilationUnitBuilder builder{native_module_};
 
   base::MutexGuard guard(&callbacks_mutex_);
+  // Nothing to compile if compilation progress is not tracked (e.g. in jitless
+  // mode).
+  if (compilation_progress_.empty()) return;
   // Functions that were executed in the profiling run are eagerly compiled to
   // Liftoff (in the background).
   for (int func_index : pgo_info->executed_functions()) {
@@ -3912,7 +3921,8 @@ void CompilationStateImpl::AddCompilationUnit(CompilationUnitBuilder* builder,
 
 void CompilationStateImpl::InitializeCompilationProgressAfterDeserialization(
     base::Vector<const int> lazy_functions,
-    base::Vector<const int> eager_functions) {
+    base::Vector<const int> eager_functions,
+    base::Vector<const int> liftoff_functions) {
   TRACE_EVENT2("v8.wasm", "wasm.CompilationAfterDeserialization",
                "num_lazy_functions", lazy_functions.size(),
                "num_eager_functions", eager_functions.size());
@@ -3966,6 +3976,21 @@ void CompilationStateImpl::InitializeCompilationProgressAfterDeserialization(
     DCHECK_NE(ExecutionTier::kNone, default_tiers.baseline_tier);
     outstanding_baseline_units_ += eager_functions.size();
 
+    // Functions for which Liftoff code was deserialized have reached the
+    // baseline tier already, but can still tier up (based on the deserialized
+    // tiering budget with dynamic tiering).
+    uint8_t progress_for_liftoff_functions =
+        RequiredBaselineTierField::encode(default_tiers.baseline_tier) |
+        RequiredTopTierField::encode(default_tiers.top_tier) |
+        ReachedTierField::encode(ExecutionTier::kLiftoff);
+    for (auto func_index : liftoff_functions) {
+      DCHECK_EQ(
+          compilation_progress_[declared_function_index(module, func_index)],
+          kProgressAfterTurbofanDeserialization);
+      compilation_progress_[declared_function_index(module, func_index)] =
+          progress_for_liftoff_functions;
+    }
+
     // Export wrappers are compiled synchronously after deserialization, so set
     // that as finished already. Baseline compilation is done if we do not have
     // any Liftoff functions to compile.
@@ -4,7 +4,11 @@
 
 #include "src/wasm/pgo.h"
 
+#include "src/tracing/trace-event.h"
+#include "src/utils/version.h"
+#include "src/wasm/compilation-environment.h"
 #include "src/wasm/decoder.h"
+#include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
 namespace v8::internal::wasm {
@@ -15,14 +19,17 @@ constexpr uint8_t kFunctionTieredUpBit = 1 << 1;
 class ProfileGenerator {
  public:
   ProfileGenerator(const WasmModule* module,
+                   base::Vector<const uint8_t> wire_bytes,
                    const std::atomic<uint32_t>* tiering_budget_array)
       : module_(module),
+        wire_bytes_(wire_bytes),
         type_feedback_mutex_guard_(&module->type_feedback.mutex),
         tiering_budget_array_(tiering_budget_array) {}
 
   base::OwnedVector<uint8_t> GetProfileData() {
     ZoneBuffer buffer{&zone_};
 
+    SerializeHeader(buffer);
     SerializeTypeFeedback(buffer);
     SerializeTieringInfo(buffer);
 
@@ -30,6 +37,13 @@ class ProfileGenerator {
   }
 
  private:
+  // The header identifies the V8 version and the module, since function
+  // indexes and feedback are meaningless for any other module.
+  void SerializeHeader(ZoneBuffer& buffer) {
+    buffer.write_u32(Version::Hash());
+    buffer.write_u32(static_cast<uint32_t>(GetWireBytesHash(wire_bytes_)));
+  }
+
   void SerializeTypeFeedback(ZoneBuffer& buffer) {
     const std::unordered_map<uint32_t, FunctionTypeFeedback>&
         feedback_for_function = module_->type_feedback.feedback_for_function;
@@ -96,26 +110,49 @@ class ProfileGenerator {
 
  private:
   const WasmModule* module_;
+  const base::Vector<const uint8_t> wire_bytes_;
   AccountingAllocator allocator_;
   Zone zone_{&allocator_, "wasm::ProfileGenerator"};
   base::SharedMutexGuard<base::kShared> type_feedback_mutex_guard_;
   const std::atomic<uint32_t>* const tiering_budget_array_;
 };
 
-void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
-  base::SharedMutexGuard<base::kShared> type_feedback_guard{
-      &module->type_feedback.mutex};
-  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
-      module->type_feedback.feedback_for_function;
+bool DeserializeHeader(Decoder& decoder,
+                       base::Vector<const uint8_t> wire_bytes) {
+  uint32_t version_hash = decoder.consume_u32("version hash", nullptr);
+  uint32_t wire_bytes_hash = decoder.consume_u32("wire bytes hash", nullptr);
+  return decoder.ok() && version_hash == Version::Hash() &&
+         wire_bytes_hash == static_cast<uint32_t>(GetWireBytesHash(wire_bytes));
+}
+
+using TypeFeedbackEntries =
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>>;
+
+// Decodes the type feedback into {entries} without installing it yet, such
+// that invalid profile data does not leave the module in a partially updated
+// state.
+bool DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module,
+                             TypeFeedbackEntries* entries) {
+  const uint32_t num_functions = static_cast<uint32_t>(module->functions.size());
+  auto is_valid_function = [num_functions](int func_index) {
+    return func_index >= 0 && static_cast<uint32_t>(func_index) < num_functions;
+  };
   uint32_t num_entries = decoder.consume_u32v("num function entries");
-  CHECK_LE(num_entries, module->num_declared_functions);
+  if (num_entries > module->num_declared_functions) return false;
+  entries->reserve(num_entries);
   for (uint32_t missing_entries = num_entries; missing_entries > 0;
        --missing_entries) {
     FunctionTypeFeedback feedback;
     uint32_t function_index = decoder.consume_u32v("function index");
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      return false;
+    }
     // Deserialize {feedback_vector}.
     uint32_t feedback_vector_size =
         decoder.consume_u32v("feedback vector size");
+    // Each call site takes at least one byte.
+    if (feedback_vector_size > decoder.available_bytes()) return false;
     feedback.feedback_vector.resize(feedback_vector_size);
     for (CallSiteFeedback& feedback : feedback.feedback_vector) {
       int num_cases = decoder.consume_i32v("num cases");
@@ -123,38 +160,67 @@ void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
       if (num_cases == 1) {          // monomorphic
         int called_function_index = decoder.consume_i32v("function index");
         int call_count = decoder.consume_i32v("call count");
+        if (!is_valid_function(called_function_index)) return false;
         feedback = CallSiteFeedback{called_function_index, call_count};
       } else {  // polymorphic
+        if (num_cases < 0 ||
+            static_cast<uint32_t>(num_cases) > decoder.available_bytes()) {
+          return false;
+        }
         auto* polymorphic = new CallSiteFeedback::PolymorphicCase[num_cases];
+        // Transfer ownership first, so {polymorphic} is freed on failure.
+        feedback = CallSiteFeedback{polymorphic, num_cases};
         for (int i = 0; i < num_cases; ++i) {
           polymorphic[i].function_index =
               decoder.consume_i32v("function index");
           polymorphic[i].absolute_call_frequency =
               decoder.consume_i32v("call count");
+          if (!is_valid_function(polymorphic[i].function_index)) return false;
         }
-        feedback = CallSiteFeedback{polymorphic, num_cases};
       }
     }
     // Deserialize {call_targets}.
     uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (num_call_targets > decoder.available_bytes()) return false;
     feedback.call_targets =
         base::OwnedVector<uint32_t>::NewForOverwrite(num_call_targets);
     for (uint32_t& call_target : feedback.call_targets) {
       call_target = decoder.consume_u32v("call target");
+      if (call_target >= num_functions &&
+          call_target != FunctionTypeFeedback::kCallRef &&
+          call_target != FunctionTypeFeedback::kCallIndirect) {
+        return false;
+      }
     }
+    if (decoder.failed()) return false;
+    entries->emplace_back(function_index, std::move(feedback));
+  }
+  return true;
+}
 
-    // Finally, insert the new feedback into the map. Overwrite existing
-    // feedback, but check for consistency.
+void InstallTypeFeedback(const WasmModule* module,
+                         TypeFeedbackEntries entries) {
+  base::SharedMutexGuard<base::kExclusive> type_feedback_guard{
+      &module->type_feedback.mutex};
+  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  for (auto& [function_index, feedback] : entries) {
+    // Overwrite existing feedback, but only if it is consistent with the new
+    // one.
     auto [feedback_it, is_new] =
-        feedback_for_function.emplace(function_index, std::move(feedback));
-    if (!is_new) {
-      FunctionTypeFeedback& old_feedback = feedback_it->second;
-      CHECK(old_feedback.feedback_vector.empty() ||
-            old_feedback.feedback_vector.size() == feedback_vector_size);
-      CHECK_EQ(old_feedback.call_targets.as_vector(),
-               feedback.call_targets.as_vector());
-      std::swap(old_feedback.feedback_vector, feedback.feedback_vector);
+        feedback_for_function.try_emplace(function_index, std::move(feedback));
+    if (is_new) continue;
+    FunctionTypeFeedback& old_feedback = feedback_it->second;
+    if (!old_feedback.feedback_vector.empty() &&
+        old_feedback.feedback_vector.size() !=
+            feedback.feedback_vector.size()) {
+      continue;
+    }
+    if (old_feedback.call_targets.as_vector() !=
+        feedback.call_targets.as_vector()) {
+      continue;
     }
+    std::swap(old_feedback.feedback_vector, feedback.feedback_vector);
   }
 }
 
@@ -166,31 +232,55 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
     uint8_t tiering_info = decoder.consume_u8("tiering info");
-    CHECK_EQ(0, tiering_info & ~3);
+    if (tiering_info & ~(kFunctionExecutedBit | kFunctionTieredUpBit)) {
+      return {};
+    }
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
     if (was_tiered_up) tiered_up_functions.push_back(func_index);
     if (was_executed) executed_functions.push_back(func_index);
   }
+  if (decoder.failed()) return {};
 
   return std::make_unique<ProfileInformation>(std::move(executed_functions),
                                               std::move(tiered_up_functions));
 }
 
+base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const std::atomic<uint32_t>* tiering_budget_array) {
+  ProfileGenerator profile_generator{module, wire_bytes, tiering_budget_array};
+  return profile_generator.GetProfileData();
+}
+
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile_data) {
   Decoder decoder{profile_data.begin(), profile_data.end()};
 
-  DeserializeTypeFeedback(decoder, module);
+  if (!DeserializeHeader(decoder, wire_bytes)) return {};
+  TypeFeedbackEntries type_feedback;
+  if (!DeserializeTypeFeedback(decoder, module, &type_feedback)) return {};
   std::unique_ptr<ProfileInformation> pgo_info =
       DeserializeTieringInformation(decoder, module);
+  if (!pgo_info || decoder.pc() != decoder.end()) return {};
 
-  CHECK(decoder.ok());
-  CHECK_EQ(decoder.pc(), decoder.end());
-
+  InstallTypeFeedback(module, std::move(type_feedback));
   return pgo_info;
 }
 
+bool ApplyProfileData(NativeModule* native_module,
+                      base::Vector<const uint8_t> profile_data) {
+  TRACE_EVENT1("v8.wasm", "wasm.ApplyProfileData", "bytes",
+               profile_data.size());
+  std::unique_ptr<ProfileInformation> pgo_info =
+      RestoreProfileData(native_module->module(), native_module->wire_bytes(),
+                         profile_data);
+  if (!pgo_info) return false;
+  native_module->compilation_state()->ApplyPgoInfo(pgo_info.get());
+  return true;
+}
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array) {
@@ -202,8 +292,8 @@ void DumpProfileToFile(const WasmModule* module,
   base::EmbeddedVector<char, 32> filename;
   SNPrintF(filename, "profile-wasm-%08x", hash);
 
-  ProfileGenerator profile_generator{module, tiering_budget_array};
-  base::OwnedVector<uint8_t> profile_data = profile_generator.GetProfileData();
+  base::OwnedVector<uint8_t> profile_data =
+      GetProfileData(module, wire_bytes, tiering_budget_array);
 
   PrintF(
       "Dumping Wasm PGO data to file '%s' (module size %zu, %u declared "
@@ -248,7 +338,10 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
 
   base::Fclose(file);
 
-  return RestoreProfileData(module, profile_data.as_vector());
+  std::unique_ptr<ProfileInformation> pgo_info =
+      RestoreProfileData(module, wire_bytes, profile_data.as_vector());
+  if (!pgo_info) PrintF("Ignoring invalid Wasm PGO data\n");
+  return pgo_info;
 }
 
 }  // namespace v8::internal::wasm
@@ -9,12 +9,15 @@
 #ifndef V8_WASM_PGO_H_
 #define V8_WASM_PGO_H_
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "src/base/vector.h"
 
 namespace v8::internal::wasm {
 
+class NativeModule;
 struct WasmModule;
 
 class ProfileInformation {
@@ -40,6 +43,27 @@ class ProfileInformation {
   const std::vector<uint32_t> tiered_up_functions_;
 };
 
+// Generate profile data for the given module. The data contains the tiering
+// information (which functions were executed and tiered up) and the collected
+// call-target feedback, and is only valid for the same wire bytes and V8
+// version.
+V8_EXPORT_PRIVATE base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const std::atomic<uint32_t>* tiering_budget_array);
+
+// Restore profile data generated by {GetProfileData}. The contained type
+// feedback is installed on the module. Returns {nullptr} if the data is
+// invalid or was generated for different wire bytes or another V8 version.
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+RestoreProfileData(const WasmModule* module,
+                   base::Vector<const uint8_t> wire_bytes,
+                   base::Vector<const uint8_t> profile_data);
+
+// Restore profile data and trigger eager compilation of the functions that
+// were hot in the profiling run. Returns false if the data is invalid.
+V8_EXPORT_PRIVATE bool ApplyProfileData(
+    NativeModule* native_module, base::Vector<const uint8_t> profile_data);
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array);
@@ -10,6 +10,7 @@
 #include "src/wasm/decoder.h"
 #include "src/wasm/leb-helper.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects.h"
@@ -386,6 +387,11 @@ class CallMoreFunctionsCanBeSerializedCallback
 
 void AsyncStreamingDecoder::NotifyNativeModuleCreated(
     const std::shared_ptr<NativeModule>& native_module) {
+  if (!profile_data_.empty()) {
+    // Invalid profile data is ignored; compilation just proceeds as usual.
+    ApplyProfileData(native_module.get(), profile_data_.as_vector());
+    profile_data_ = {};
+  }
   if (!more_functions_can_be_serialized_callback_) return;
   auto* comp_state = native_module->compilation_state();
 
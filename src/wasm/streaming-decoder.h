@@ -98,6 +98,13 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
     compiled_module_bytes_ = bytes;
   }
 
+  // Passes profile data from a previous run of the module (see
+  // {GetProfileData}), which is used to eagerly compile hot functions once the
+  // module is compiled.
+  void SetProfileData(base::Vector<const uint8_t> profile_data) {
+    profile_data_ = base::OwnedVector<uint8_t>::Of(profile_data);
+  }
+
   virtual void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) = 0;
 
@@ -126,6 +133,9 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   // The content of `compiled_module_bytes_` shouldn't be used until
   // Finish(true) is called.
   base::Vector<const uint8_t> compiled_module_bytes_;
+  // A copy of the profile data, since the embedder's buffer is not guaranteed
+  // to stay alive until the module is compiled.
+  base::OwnedVector<uint8_t> profile_data_;
 };
 
 }  // namespace v8::internal::wasm
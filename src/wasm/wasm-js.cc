@@ -94,6 +94,10 @@ class WasmStreaming::WasmStreamingImpl {
     return true;
   }
 
+  void SetProfile(base::Vector<const uint8_t> bytes) {
+    streaming_decoder_->SetProfileData(bytes);
+  }
+
   void SetMoreFunctionsCanBeSerializedCallback(
       std::function<void(CompiledWasmModule)> callback) {
     streaming_decoder_->SetMoreFunctionsCanBeSerializedCallback(
@@ -142,6 +146,11 @@ bool WasmStreaming::SetCompiledModuleBytes(const uint8_t* bytes, size_t size) {
   return impl_->SetCompiledModuleBytes(base::VectorOf(bytes, size));
 }
 
+void WasmStreaming::SetProfile(const uint8_t* bytes, size_t size) {
+  TRACE_EVENT1("v8.wasm", "wasm.SetProfile", "bytes", size);
+  impl_->SetProfile(base::VectorOf(bytes, size));
+}
+
 void WasmStreaming::SetMoreFunctionsCanBeSerializedCallback(
     std::function<void(CompiledWasmModule)> callback) {
   impl_->SetMoreFunctionsCanBeSerializedCallback(std::move(callback));
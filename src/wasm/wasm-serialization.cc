@@ -31,6 +31,19 @@ namespace {
 constexpr uint8_t kLazyFunction = 2;
 constexpr uint8_t kEagerFunction = 3;
 constexpr uint8_t kTurboFanFunction = 4;
+constexpr uint8_t kLiftoffFunction = 5;
+
+// Liftoff code is only serialized with --wasm-serialize-liftoff-code. Debug
+// code is never serialized, as it can contain breakpoints. This also excludes
+// Liftoff code that counts execution steps or detects nondeterminism for
+// fuzzing, which embeds raw addresses of counters in the current process;
+// ExecuteLiftoffCompilation checks that such code is always compiled for
+// debugging.
+bool ShouldSerializeCode(const WasmCode* code) {
+  if (code->tier() == ExecutionTier::kTurbofan) return true;
+  return v8_flags.wasm_serialize_liftoff_code &&
+         code->tier() == ExecutionTier::kLiftoff && !code->for_debugging();
+}
 
 // TODO(bbudge) Try to unify the various implementations of readers and writers
 // in Wasm, e.g. StreamProcessor and ZoneBuffer, with these.
@@ -309,6 +322,7 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool write_called_ = false;
   size_t total_written_code_ = 0;
   int num_turbofan_functions_ = 0;
+  int num_liftoff_functions_ = 0;
 };
 
 NativeModuleSerializer::NativeModuleSerializer(
@@ -325,9 +339,7 @@ NativeModuleSerializer::NativeModuleSerializer(
 size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
   if (code == nullptr) return sizeof(uint8_t);
   DCHECK_EQ(WasmCode::kWasmFunction, code->kind());
-  if (code->tier() != ExecutionTier::kTurbofan) {
-    return sizeof(uint8_t);
-  }
+  if (!ShouldSerializeCode(code)) return sizeof(uint8_t);
   return kCodeHeaderSize + code->instructions().size() +
          code->reloc_info().size() + code->source_positions().size() +
          code->inlining_positions().size() +
@@ -387,9 +399,9 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   }
 
   DCHECK_EQ(WasmCode::kWasmFunction, code->kind());
-  // Only serialize TurboFan code, as Liftoff code can contain breakpoints or
-  // non-relocatable constants.
-  if (code->tier() != ExecutionTier::kTurbofan) {
+  // Only serialize TurboFan code (and non-debug Liftoff code if requested), as
+  // debug code can contain breakpoints.
+  if (!ShouldSerializeCode(code)) {
     // We check if the function has been executed already. If so, we serialize
     // it as {kEagerFunction} so that upon deserialization the function will
     // get eagerly compiled with Liftoff (if enabled). If the function has not
@@ -406,8 +418,13 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
     return;
   }
 
-  ++num_turbofan_functions_;
-  writer->Write(kTurboFanFunction);
+  if (code->tier() == ExecutionTier::kTurbofan) {
+    ++num_turbofan_functions_;
+    writer->Write(kTurboFanFunction);
+  } else {
+    ++num_liftoff_functions_;
+    writer->Write(kLiftoffFunction);
+  }
   // Write the size of the entire code section, followed by the code header.
   writer->Write(code->constant_pool_offset());
   writer->Write(code->safepoint_table_offset());
@@ -553,7 +570,7 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
   size_t total_code_size = 0;
   for (WasmCode* code : code_table_) {
-    if (code && code->tier() == ExecutionTier::kTurbofan) {
+    if (code && ShouldSerializeCode(code)) {
       DCHECK(IsAligned(code->instructions().size(), kCodeAlignment));
       total_code_size += code->instructions().size();
     }
@@ -566,7 +583,7 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   // No TurboFan-compiled functions in jitless mode.
   if (!v8_flags.wasm_jitless) {
     // If not a single function was written, serialization was not successful.
-    if (num_turbofan_functions_ == 0) return false;
+    if (num_turbofan_functions_ + num_liftoff_functions_ == 0) return false;
   }
 
   // Make sure that the serialized total code size was correct.
@@ -662,6 +679,10 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
     return base::VectorOf(eager_functions_);
   }
 
+  base::Vector<const int> liftoff_functions() {
+    return base::VectorOf(liftoff_functions_);
+  }
+
  private:
   friend class DeserializeCodeTask;
 
@@ -684,6 +705,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> eager_functions_;
+  std::vector<int> liftoff_functions_;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -848,6 +870,9 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
     eager_functions_.push_back(fn_index);
     return {};
   }
+  if (code_kind == kLiftoffFunction) {
+    liftoff_functions_.push_back(fn_index);
+  }
 
   int constant_pool_offset = reader->Read<int>();
   int safepoint_table_offset = reader->Read<int>();
@@ -867,6 +892,7 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
   int protected_instructions_size = reader->Read<int>();
   WasmCode::Kind kind = reader->Read<WasmCode::Kind>();
   ExecutionTier tier = reader->Read<ExecutionTier>();
+  DCHECK_EQ(code_kind == kLiftoffFunction, tier == ExecutionTier::kLiftoff);
 
   DCHECK(IsAligned(code_size, kCodeAlignment));
   DCHECK_GE(remaining_code_size_, code_size);
@@ -1062,7 +1088,8 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
       return {};
     }
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
-        deserializer.lazy_functions(), deserializer.eager_functions());
+        deserializer.lazy_functions(), deserializer.eager_functions(),
+        deserializer.liftoff_functions());
     wasm_engine->UpdateNativeModuleCache(error, shared_native_module, isolate);
   }
 
@@ -11,6 +11,7 @@
 #include "src/base/macros.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
+#include "src/zone/zone-segment-pool.h"
 #include "src/zone/zone-segment.h"
 
 namespace v8 {
@@ -85,6 +86,8 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (ZoneSegmentPool::IsPooledSize(bytes)) {
+    memory = ZoneSegmentPool::Get()->Allocate(bytes);
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -111,6 +114,8 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
+  } else if (ZoneSegmentPool::IsPooledSize(segment_size)) {
+    ZoneSegmentPool::Get()->Free(segment, segment_size);
   } else {
     free(segment);
   }
@@ -31,7 +31,8 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   AccountingAllocator& operator=(const AccountingAllocator&) = delete;
   virtual ~AccountingAllocator();
 
-  // Allocates a new segment. Returns nullptr on failed allocation.
+  // Allocates a new segment, reusing the memory of a segment in the
+  // ZoneSegmentPool if possible. Returns nullptr on failed allocation.
   Segment* AllocateSegment(size_t bytes, bool supports_compression);
 
   // Return unneeded segments to either insert them into the pool or release
@@ -0,0 +1,174 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/zone-segment-pool.h"
+
+#include <algorithm>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/memory.h"
+#include "src/base/sanitizer/asan.h"
+#include "src/flags/flags.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+// The segments that a thread returned most recently, up to kThreadCacheSize
+// bytes, ordered from the least to the most recently returned one.
+class ZoneSegmentPool::ThreadCache final {
+ public:
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache&) = delete;
+  ThreadCache& operator=(const ThreadCache&) = delete;
+  ~ThreadCache() { Flush(ZoneSegmentPool::Get()); }
+
+  // Takes the most recently returned segment of {bytes} out of the cache, if
+  // any.
+  void* Take(size_t bytes) {
+    for (int i = count_ - 1; i >= 0; --i) {
+      if (entries_[i].bytes != bytes) continue;
+      void* memory = entries_[i].memory;
+      std::copy(entries_ + i + 1, entries_ + count_, entries_ + i);
+      --count_;
+      size_ -= bytes;
+      return memory;
+    }
+    return nullptr;
+  }
+
+  // Caches the segment, moving the least recently returned segments to the
+  // shared lists of {pool} to make room for it.
+  void Put(ZoneSegmentPool* pool, void* memory, size_t bytes) {
+    DCHECK_LE(bytes, kThreadCacheSize);
+    int evicted = 0;
+    while (size_ + bytes > kThreadCacheSize) {
+      pool->FreeShared(entries_[evicted].memory, entries_[evicted].bytes);
+      size_ -= entries_[evicted].bytes;
+      ++evicted;
+    }
+    std::copy(entries_ + evicted, entries_ + count_, entries_);
+    count_ -= evicted;
+    DCHECK_LT(count_, kCapacity);
+    ASAN_POISON_MEMORY_REGION(memory, bytes);
+    entries_[count_++] = {memory, bytes};
+    size_ += bytes;
+  }
+
+  // Moves all segments to the shared lists of {pool}.
+  void Flush(ZoneSegmentPool* pool) {
+    for (int i = 0; i < count_; ++i) {
+      pool->FreeShared(entries_[i].memory, entries_[i].bytes);
+    }
+    count_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  static constexpr int kCapacity = kThreadCacheSize / kMinPooledSize;
+
+  struct Entry {
+    void* memory;
+    size_t bytes;
+  };
+
+  Entry entries_[kCapacity];
+  int count_ = 0;
+  size_t size_ = 0;
+};
+
+static_assert(ZoneSegmentPool::kMaxPooledSize <=
+              ZoneSegmentPool::kThreadCacheSize);
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ZoneSegmentPool, ZoneSegmentPool::Get)
+
+// static
+ZoneSegmentPool::ThreadCache& ZoneSegmentPool::CurrentThreadCache() {
+  static thread_local ThreadCache thread_cache;
+  return thread_cache;
+}
+
+// static
+bool ZoneSegmentPool::IsPooledSize(size_t bytes) {
+  return (bytes == kMinPooledSize || bytes == kMaxPooledSize) &&
+         v8_flags.zone_segment_pool_size > 0;
+}
+
+void* ZoneSegmentPool::Allocate(size_t bytes) {
+  DCHECK(IsPooledSize(bytes));
+  void* memory = CurrentThreadCache().Take(bytes);
+  if (memory != nullptr) {
+    thread_cache_hit_count_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    memory = AllocateShared(SizeClass(bytes));
+  }
+  if (memory == nullptr) {
+    miss_count_.fetch_add(1, std::memory_order_relaxed);
+    return AllocWithRetry(bytes);
+  }
+  hit_count_.fetch_add(1, std::memory_order_relaxed);
+  ASAN_UNPOISON_MEMORY_REGION(memory, bytes);
+  return memory;
+}
+
+void ZoneSegmentPool::Free(void* memory, size_t bytes) {
+  DCHECK(IsPooledSize(bytes));
+  CurrentThreadCache().Put(this, memory, bytes);
+}
+
+void ZoneSegmentPool::ReleaseMemory() {
+  CurrentThreadCache().Flush(this);
+  FreeSegment* lists[kSizeClassCount];
+  {
+    base::MutexGuard guard(&mutex_);
+    std::copy(shared_, shared_ + kSizeClassCount, lists);
+    std::fill(shared_, shared_ + kSizeClassCount, nullptr);
+    shared_size_.store(0, std::memory_order_relaxed);
+  }
+  for (int size_class = 0; size_class < kSizeClassCount; ++size_class) {
+    FreeSegment* segment = lists[size_class];
+    while (segment != nullptr) {
+      ASAN_UNPOISON_MEMORY_REGION(segment, sizeof(FreeSegment));
+      FreeSegment* next = segment->next;
+      FreeToSystem(segment);
+      segment = next;
+    }
+  }
+}
+
+void* ZoneSegmentPool::AllocateShared(int size_class) {
+  base::MutexGuard guard(&mutex_);
+  FreeSegment* segment = shared_[size_class];
+  if (segment == nullptr) return nullptr;
+  ASAN_UNPOISON_MEMORY_REGION(segment, sizeof(FreeSegment));
+  shared_[size_class] = segment->next;
+  shared_size_.fetch_sub(SizeClassSize(size_class), std::memory_order_relaxed);
+  return segment;
+}
+
+void ZoneSegmentPool::FreeShared(void* memory, size_t bytes) {
+  {
+    base::MutexGuard guard(&mutex_);
+    size_t size = shared_size_.load(std::memory_order_relaxed);
+    if (size + bytes <= v8_flags.zone_segment_pool_size) {
+      int size_class = SizeClass(bytes);
+      ASAN_UNPOISON_MEMORY_REGION(memory, sizeof(FreeSegment));
+      FreeSegment* segment = new (memory) FreeSegment{shared_[size_class]};
+      ASAN_POISON_MEMORY_REGION(memory, bytes);
+      shared_[size_class] = segment;
+      shared_size_.store(size + bytes, std::memory_order_relaxed);
+      return;
+    }
+  }
+  ASAN_UNPOISON_MEMORY_REGION(memory, bytes);
+  FreeToSystem(memory);
+}
+
+void ZoneSegmentPool::FreeToSystem(void* memory) {
+  release_count_.fetch_add(1, std::memory_order_relaxed);
+  base::Free(memory);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,121 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_ZONE_ZONE_SEGMENT_POOL_H_
+#define V8_ZONE_ZONE_SEGMENT_POOL_H_
+
+#include <atomic>
+
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide pool of the memory of free zone segments, which keeps the
+// memory committed so that compilations don't have to go to malloc and fault
+// in fresh pages for every zone.
+//
+// Only segments of exactly Zone::kMinimumSegmentSize or
+// Zone::kMaximumSegmentSize bytes are pooled. Zone::Expand allocates the
+// former for the first segment of a zone and the latter once the zone has
+// grown, as long as the requested allocation is small. The segments in between
+// have sizes that depend on the requested allocation and are not pooled, so
+// that the pool never hands out more memory than the zone asked for.
+// Each thread caches a few segments for itself, so that a thread that
+// repeatedly creates and destroys zones doesn't have to synchronize with other
+// threads, and keeps using memory that it touched recently. Memory that
+// doesn't fit in a thread's cache goes to shared lists that are limited to
+// --zone-segment-pool-size bytes in total. All caches hand out the most
+// recently returned segments first.
+class V8_EXPORT_PRIVATE ZoneSegmentPool final {
+ public:
+  static constexpr size_t kMinPooledSize = 8 * KB;
+  static constexpr size_t kMaxPooledSize = 32 * KB;
+  // The number of bytes that each thread caches for itself.
+  static constexpr size_t kThreadCacheSize = 64 * KB;
+
+  static ZoneSegmentPool* Get();
+
+  ZoneSegmentPool() = default;
+  ZoneSegmentPool(const ZoneSegmentPool&) = delete;
+  ZoneSegmentPool& operator=(const ZoneSegmentPool&) = delete;
+
+  // Whether segments of {bytes} are allocated from the pool.
+  static bool IsPooledSize(size_t bytes);
+
+  // Returns the memory for a segment of {bytes}, which must be a pooled size.
+  // Returns nullptr on failed allocation. The memory must be returned with
+  // Free.
+  void* Allocate(size_t bytes);
+
+  // Puts the memory of a segment of {bytes} that was allocated with Allocate
+  // into the pool, or frees it if the pool is full.
+  void Free(void* memory, size_t bytes);
+
+  // Frees the memory in the shared lists and in the cache of the current
+  // thread, e.g. on memory pressure.
+  void ReleaseMemory();
+
+  // Allocations served from the pool, including those from thread caches.
+  uint64_t hit_count() const {
+    return hit_count_.load(std::memory_order_relaxed);
+  }
+  // Allocations served from the cache of the allocating thread.
+  uint64_t thread_cache_hit_count() const {
+    return thread_cache_hit_count_.load(std::memory_order_relaxed);
+  }
+  // Allocations that had to allocate fresh memory.
+  uint64_t miss_count() const {
+    return miss_count_.load(std::memory_order_relaxed);
+  }
+  // Segments that were freed because the shared lists were full or released.
+  uint64_t release_count() const {
+    return release_count_.load(std::memory_order_relaxed);
+  }
+  // Bytes currently held by the shared lists.
+  size_t shared_size() const {
+    return shared_size_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  class ThreadCache;
+
+  static ThreadCache& CurrentThreadCache();
+
+  // The header that free segments in the shared lists are linked with.
+  struct FreeSegment {
+    FreeSegment* next;
+  };
+
+  static constexpr int kSizeClassCount = 2;
+
+  static int SizeClass(size_t bytes) {
+    DCHECK(bytes == kMinPooledSize || bytes == kMaxPooledSize);
+    return bytes == kMinPooledSize ? 0 : 1;
+  }
+  static size_t SizeClassSize(int size_class) {
+    return size_class == 0 ? kMinPooledSize : kMaxPooledSize;
+  }
+
+  void* AllocateShared(int size_class);
+  void FreeShared(void* memory, size_t bytes);
+  void FreeToSystem(void* memory);
+
+  base::Mutex mutex_;
+  FreeSegment* shared_[kSizeClassCount] = {};
+  std::atomic<size_t> shared_size_{0};
+
+  std::atomic<uint64_t> hit_count_{0};
+  std::atomic<uint64_t> thread_cache_hit_count_{0};
+  std::atomic<uint64_t> miss_count_{0};
+  std::atomic<uint64_t> release_count_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ZONE_ZONE_SEGMENT_POOL_H_
@@ -11,6 +11,7 @@
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 #include "src/zone/type-stats.h"
+#include "src/zone/zone-segment-pool.h"
 
 namespace v8 {
 namespace internal {
@@ -161,6 +162,9 @@ void Zone::Expand(size_t size) {
   if (new_size_no_overhead < size || new_size < kSegmentOverhead) {
     V8::FatalProcessOutOfMemory(nullptr, "Zone");
   }
+  // The ZoneSegmentPool keeps the memory of segments of these two sizes.
+  static_assert(kMinimumSegmentSize == ZoneSegmentPool::kMinPooledSize);
+  static_assert(kMaximumSegmentSize == ZoneSegmentPool::kMaxPooledSize);
   if (new_size < kMinimumSegmentSize) {
     new_size = kMinimumSegmentSize;
   } else if (new_size >= kMaximumSegmentSize) {
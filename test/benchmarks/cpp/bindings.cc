@@ -2,8 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "include/cppgc/allocation.h"
+#include "include/v8-array-buffer.h"
 #include "include/v8-context.h"
+#include "include/v8-fast-api-calls.h"
 #include "include/v8-internal.h"
 #include "include/v8-local-handle.h"
 #include "include/v8-persistent-handle.h"
@@ -143,6 +147,55 @@ v8::Local<v8::ObjectTemplate> GetInstanceTemplateForContext(
   return instance_tpl;
 }
 
+uint32_t SumBytes(const uint8_t* bytes, size_t length) {
+  uint32_t sum = 0;
+  for (size_t i = 0; i < length; ++i) sum += bytes[i];
+  return sum;
+}
+
+uint32_t CountSpaces(const char* chars, size_t length) {
+  return static_cast<uint32_t>(std::count(chars, chars + length, ' '));
+}
+
+// Fast API callbacks receive typed arrays and one-byte strings as views on
+// their contents.
+uint32_t SumBytesFastCallback(v8::Local<v8::Object> receiver,
+                              const v8::FastApiArrayBufferView& view) {
+  return SumBytes(static_cast<const uint8_t*>(view.data), view.byte_length);
+}
+
+void SumBytesSlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Local<v8::ArrayBufferView> view = info[0].As<v8::ArrayBufferView>();
+  const uint8_t* bytes =
+      static_cast<const uint8_t*>(view->Buffer()->Data()) + view->ByteOffset();
+  info.GetReturnValue().Set(SumBytes(bytes, view->ByteLength()));
+}
+
+uint32_t CountSpacesFastCallback(v8::Local<v8::Object> receiver,
+                                 const v8::FastOneByteString& string) {
+  return CountSpaces(string.data, string.length);
+}
+
+void CountSpacesSlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::String::Utf8Value string(info.GetIsolate(), info[0]);
+  info.GetReturnValue().Set(CountSpaces(*string, string.length()));
+}
+
+// Installs `name` as a method on `object_template` that is called through
+// `c_function` from optimized code if there is one, and through
+// `slow_callback` otherwise.
+void SetMethod(v8::Isolate* isolate,
+               v8::Local<v8::ObjectTemplate> object_template, const char* name,
+               v8::FunctionCallback slow_callback,
+               const v8::CFunction* c_function) {
+  object_template->Set(
+      v8_str(name),
+      v8::FunctionTemplate::New(
+          isolate, slow_callback, v8::Local<v8::Value>(),
+          v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow,
+          v8::SideEffectType::kHasSideEffect, c_function));
+}
+
 template <typename ConcreteBindings>
 class BindingsBenchmarkBase : public v8::benchmarking::BenchmarkWithIsolate {
  public:
@@ -200,6 +253,19 @@ class BindingsBenchmarkBase : public v8::benchmarking::BenchmarkWithIsolate {
         v8_str("accessorReturningSmi"),
         v8::FunctionTemplate::New(isolate, &AccessorReturningSmi));
 
+    static const v8::CFunction kSumBytesCFunction =
+        v8::CFunction::Make(SumBytesFastCallback);
+    static const v8::CFunction kCountSpacesCFunction =
+        v8::CFunction::Make(CountSpacesFastCallback);
+    SetMethod(isolate, object_template, "sumBytes", &SumBytesSlowCallback,
+              &kSumBytesCFunction);
+    SetMethod(isolate, object_template, "sumBytesSlow", &SumBytesSlowCallback,
+              nullptr);
+    SetMethod(isolate, object_template, "countSpaces", &CountSpacesSlowCallback,
+              &kCountSpacesCFunction);
+    SetMethod(isolate, object_template, "countSpacesSlow",
+              &CountSpacesSlowCallback, nullptr);
+
     v8::Local<v8::Context> context =
         v8::Context::New(isolate, nullptr, object_template);
 
@@ -414,3 +480,41 @@ BENCHMARK_F(ManagedBindings, AccessorReturningSmi)(benchmark::State& st) {
     benchmark::DoNotOptimize(result);
   }
 }
+
+// The following benchmarks don't depend on how wrappers are managed. They
+// compare fast API calls taking views on a typed array and on a one-byte
+// string with regular API callbacks doing the same.
+
+#define BENCHMARK_SCRIPT(Name, source)                                     \
+  BENCHMARK_F(UnmanagedBindings, Name)(benchmark::State & st) {            \
+    v8::HandleScope handle_scope(v8_isolate());                            \
+    v8::Local<v8::Context> context = v8_context();                         \
+    v8::Local<v8::Script> script = CompileBenchmarkScript(source);         \
+    v8::HandleScope benchmark_handle_scope(v8_isolate());                  \
+    for (auto _ : st) {                                                    \
+      USE(_);                                                              \
+      v8::Local<v8::Value> result = script->Run(context).ToLocalChecked(); \
+      benchmark::DoNotOptimize(result);                                    \
+    }                                                                      \
+  }
+
+BENCHMARK_SCRIPT(FastApiTypedArrayView,
+                 "var bytes = new Uint8Array(64);"
+                 "function invoke() { return globalThis.sumBytes(bytes); }"
+                 "for (var i =0; i < 1_000; i++) invoke();")
+BENCHMARK_SCRIPT(SlowApiTypedArrayView,
+                 "var bytes = new Uint8Array(64);"
+                 "function invoke() { return globalThis.sumBytesSlow(bytes); }"
+                 "for (var i =0; i < 1_000; i++) invoke();")
+BENCHMARK_SCRIPT(FastApiOneByteString,
+                 "var string = 'a short one-byte string';"
+                 "function invoke() { return globalThis.countSpaces(string); }"
+                 "for (var i =0; i < 1_000; i++) invoke();")
+BENCHMARK_SCRIPT(SlowApiOneByteString,
+                 "var string = 'a short one-byte string';"
+                 "function invoke() {"
+                 "  return globalThis.countSpacesSlow(string);"
+                 "}"
+                 "for (var i =0; i < 1_000; i++) invoke();")
+
+#undef BENCHMARK_SCRIPT
@@ -0,0 +1,170 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compares the dictionary backing stores of dictionary-mode objects:
+// NameDictionary and SwissNameDictionary. Both are benchmarked independently
+// of the v8_enable_swiss_name_dictionary build configuration.
+
+#include <string>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/dictionary-inl.h"
+#include "src/objects/swiss-name-dictionary-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::internal::Handle;
+using v8::internal::InternalIndex;
+using v8::internal::Isolate;
+using v8::internal::Name;
+using v8::internal::NameDictionary;
+using v8::internal::Object;
+using v8::internal::PropertyDetails;
+using v8::internal::Smi;
+using v8::internal::SwissNameDictionary;
+
+struct NameDictionaryTraits {
+  using Table = NameDictionary;
+
+  static Handle<Table> New(Isolate* isolate, int capacity) {
+    return NameDictionary::New(isolate, capacity);
+  }
+  static Handle<Table> Add(Isolate* isolate, Handle<Table> table,
+                           Handle<Name> key, Handle<Object> value) {
+    return NameDictionary::Add(isolate, table, key, value,
+                               PropertyDetails::Empty());
+  }
+  static InternalIndex Find(Isolate* isolate, Handle<Table> table,
+                            Handle<Name> key) {
+    return table->FindEntry(isolate, key);
+  }
+  static Handle<Table> Delete(Isolate* isolate, Handle<Table> table,
+                              InternalIndex entry) {
+    return NameDictionary::Shrink(
+        isolate, NameDictionary::DeleteEntry(isolate, table, entry));
+  }
+};
+
+struct SwissNameDictionaryTraits {
+  using Table = SwissNameDictionary;
+
+  static Handle<Table> New(Isolate* isolate, int capacity) {
+    return isolate->factory()->NewSwissNameDictionary(capacity);
+  }
+  static Handle<Table> Add(Isolate* isolate, Handle<Table> table,
+                           Handle<Name> key, Handle<Object> value) {
+    return SwissNameDictionary::Add(isolate, table, key, value,
+                                    PropertyDetails::Empty());
+  }
+  static InternalIndex Find(Isolate* isolate, Handle<Table> table,
+                            Handle<Name> key) {
+    return table->FindEntry(isolate, *key);
+  }
+  static Handle<Table> Delete(Isolate* isolate, Handle<Table> table,
+                              InternalIndex entry) {
+    // SwissNameDictionary::DeleteEntry already shrinks the table if needed.
+    return SwissNameDictionary::DeleteEntry(isolate, table, entry);
+  }
+};
+
+template <typename Traits>
+class DictionaryBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  using Table = typename Traits::Table;
+
+  Isolate* isolate() { return reinterpret_cast<Isolate*>(v8_isolate()); }
+
+  std::vector<Handle<Name>> CreateKeys(benchmark::State& state) {
+    int count = static_cast<int>(state.range(0));
+    std::vector<Handle<Name>> keys;
+    keys.reserve(count);
+    for (int i = 0; i < count; i++) {
+      std::string key = "property" + std::to_string(i);
+      keys.push_back(isolate()->factory()->InternalizeUtf8String(key.c_str()));
+    }
+    return keys;
+  }
+
+  Handle<Table> CreateTable(const std::vector<Handle<Name>>& keys) {
+    Handle<Table> table = Traits::New(isolate(), 0);
+    for (size_t i = 0; i < keys.size(); i++) {
+      table = Traits::Add(isolate(), table, keys[i],
+                          handle(Smi::FromInt(static_cast<int>(i)), isolate()));
+    }
+    return table;
+  }
+
+  void Lookup(benchmark::State& state) {
+    v8::HandleScope handle_scope(v8_isolate());
+    std::vector<Handle<Name>> keys = CreateKeys(state);
+    Handle<Table> table = CreateTable(keys);
+    for (auto _ : state) {
+      USE(_);
+      for (Handle<Name> key : keys) {
+        InternalIndex entry = Traits::Find(isolate(), table, key);
+        benchmark::DoNotOptimize(entry);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+  }
+
+  void Insert(benchmark::State& state) {
+    v8::HandleScope handle_scope(v8_isolate());
+    std::vector<Handle<Name>> keys = CreateKeys(state);
+    for (auto _ : state) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      Handle<Table> table = CreateTable(keys);
+      benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+  }
+
+  void Delete(benchmark::State& state) {
+    v8::HandleScope handle_scope(v8_isolate());
+    std::vector<Handle<Name>> keys = CreateKeys(state);
+    for (auto _ : state) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      state.PauseTiming();
+      Handle<Table> table = CreateTable(keys);
+      state.ResumeTiming();
+      for (Handle<Name> key : keys) {
+        table = Traits::Delete(isolate(), table,
+                               Traits::Find(isolate(), table, key));
+      }
+      benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+  }
+};
+
+}  // namespace
+
+#define DICTIONARY_BENCHMARK(Operation, Traits)                             \
+  BENCHMARK_TEMPLATE_DEFINE_F(DictionaryBenchmark, Operation##_##Traits,    \
+                              Traits)                                       \
+  (benchmark::State & state) {                                              \
+    Operation(state);                                                       \
+  }                                                                         \
+  BENCHMARK_REGISTER_F(DictionaryBenchmark, Operation##_##Traits)           \
+      ->Arg(8)                                                              \
+      ->Arg(64)                                                             \
+      ->Arg(1024);
+
+DICTIONARY_BENCHMARK(Lookup, NameDictionaryTraits)
+DICTIONARY_BENCHMARK(Lookup, SwissNameDictionaryTraits)
+DICTIONARY_BENCHMARK(Insert, NameDictionaryTraits)
+DICTIONARY_BENCHMARK(Insert, SwissNameDictionaryTraits)
+DICTIONARY_BENCHMARK(Delete, NameDictionaryTraits)
+DICTIONARY_BENCHMARK(Delete, SwissNameDictionaryTraits)
+
+#undef DICTIONARY_BENCHMARK
@@ -5,6 +5,8 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +38,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +126,20 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs each task of {RunInParallel} on its own thread.
+class ThreadedPlatform : public Platform {
+ public:
+  static constexpr int kThreads = 4;
+
+  int MaxParallelism() override { return kThreads; }
+  void RunInParallel(int count, const std::function<void(int)>& task) override {
+    std::vector<std::thread> threads;
+    for (int i = 1; i < count; i++) threads.emplace_back(task, i);
+    task(0);
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -130,12 +147,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadedPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -204,6 +226,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +337,74 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  // Compares the results of a processor that splits huge operations across
+  // threads with those of the regular, single-threaded processor.
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    {
+      uint64_t random_bits = rng_.NextUint64();
+      int right_size =
+          kFftParallelThreshold + static_cast<int>(random_bits & 4095);
+      random_bits >>= 12;
+      int left_size = right_size + static_cast<int>(random_bits & 4095);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits reference(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->MultiplyFFT(result, A, B);
+      processor()->MultiplyFFT(reference, A, B);
+      AssertEquals(A, B, reference, result);
+      if (error_) return;
+      (*count)++;
+      // Squaring only transforms one input.
+      int square_len = MultiplyResultLength(A, A);
+      ScratchDigits square(square_len);
+      ScratchDigits square_reference(square_len);
+      parallel_processor()->MultiplyFFT(square, A, A);
+      processor()->MultiplyFFT(square_reference, A, A);
+      AssertEquals(A, A, square_reference, square);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+    constexpr int kMaxDigits = 1 << 20;  // Any large-enough value will do.
+    int size = 4 * kToStringParallelThreshold +
+               static_cast<int>(rng_.NextUint64() & 4095);
+    ScratchDigits X(size);
+    GenerateRandom(X);
+    constexpr int radix = 10;
+    int chars_required = ToStringResultLength(X, radix, false);
+    int result_len = chars_required;
+    int reference_len = chars_required;
+    std::unique_ptr<char[]> result(new char[result_len]);
+    std::unique_ptr<char[]> reference(new char[reference_len]);
+    parallel_processor()->ToStringImpl(result.get(), &result_len, X, radix,
+                                       false, true);
+    processor()->ToStringImpl(reference.get(), &reference_len, X, radix, false,
+                              true);
+    AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                 result_len);
+    if (error_) return;
+    (*count)++;
+
+    const char* start = reference.get();
+    const char* end = start + reference_len;
+    FromStringAccumulator accumulator(kMaxDigits);
+    FromStringAccumulator ref_accumulator(kMaxDigits);
+    accumulator.Parse(start, end, radix);
+    ref_accumulator.Parse(start, end, radix);
+    ScratchDigits parsed(accumulator.ResultLength());
+    ScratchDigits parsed_reference(ref_accumulator.ResultLength());
+    parallel_processor()->FromString(parsed, &accumulator);
+    processor()->FromString(parsed_reference, &ref_accumulator);
+    AssertEquals(start, reference_len, radix, parsed_reference, parsed);
+    if (error_) return;
+    (*count)++;
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -617,6 +711,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
@@ -37,19 +37,6 @@ class CSATestRunner {
  public:
   CSATestRunner(Isolate* isolate, int initial_capacity, KeyCache& keys);
 
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  static bool IsEnabled() {
-#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_IA32
-    CpuFeatures::SupportedFeatures();
-    return CpuFeatures::IsSupported(CpuFeature::AVX) ||
-           CpuFeatures::IsSupported(CpuFeature::SSSE3);
-#else
-    // Other 64-bit architectures always support the required operations.
-    return true;
-#endif
-  }
-
   void Add(Handle<Name> key, Handle<Object> value, PropertyDetails details);
   InternalIndex FindEntry(Handle<Name> key);
   void Put(InternalIndex entry, Handle<Object> new_value,
@@ -268,11 +255,6 @@ void CSATestRunner::PrintTable() {
 }
 
 Handle<Code> CSATestRunner::create_find_entry(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kFindEntryParams == 2);  // (table, key)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kFindEntryParams));
@@ -343,11 +325,6 @@ Handle<Code> CSATestRunner::create_put(Isolate* isolate) {
 }
 
 Handle<Code> CSATestRunner::create_delete(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kDeleteParams == 2);  // (table, entry)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kDeleteParams));
@@ -369,11 +346,6 @@ Handle<Code> CSATestRunner::create_delete(Isolate* isolate) {
 }
 
 Handle<Code> CSATestRunner::create_add(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kAddParams == 4);  // (table, key, value, details)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kAddParams));
@@ -472,6 +444,30 @@ void CSATestRunner::CheckAgainstReference() {
 const char kCSATestFileName[] = __FILE__;
 SharedSwissTableTests<CSATestRunner, kCSATestFileName> execute_shared_tests_csa;
 
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_IA32
+// Generates the CSA code as if only SSE2 were available, so that the group
+// matching uses the SSE2 fallback for splatting the H2 byte.
+TEST(SwissNameDictionaryCSAWithSSE2Only) {
+  static constexpr CpuFeature kNonSSE2Features[] = {
+      SSE3, SSSE3,    SSE4_1,        SSE4_2, AVX,
+      AVX2, AVX_VNNI, AVX_VNNI_INT8, FMA3,   F16C};
+  const unsigned supported = CpuFeatures::SupportedFeatures();
+  for (CpuFeature f : kNonSSE2Features) CpuFeatures::SetUnsupported(f);
+
+  using Tests = SharedSwissTableTests<CSATestRunner, kCSATestFileName>;
+  Tests::TS::WithAllInterestingInitialCapacities([](Tests::TS& s) {
+    int count = SwissNameDictionary::MaxUsableCapacity(s.initial_capacity);
+    Tests::AddMultiple(s, count);
+    Tests::CheckMultiple(s, count);
+    s.CheckKeyAbsent(Key{"key" + std::to_string(count)});
+  });
+
+  for (CpuFeature f : kNonSSE2Features) {
+    if (supported & (1u << f)) CpuFeatures::SetSupported(f);
+  }
+}
+#endif  // V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_IA32
+
 #endif
 
 #include "src/codegen/undef-code-stub-assembler-macros.inc"
@@ -22,10 +22,6 @@ class RuntimeTestRunner {
         initial_capacity, AllocationType::kYoung);
   }
 
-  // The runtime implementations does not depend on the CPU features and
-  // therefore always work.
-  static bool IsEnabled() { return true; }
-
   void Add(DirectHandle<Name> key, DirectHandle<Object> value,
            PropertyDetails details);
   InternalIndex FindEntry(DirectHandle<Name> key);
@@ -388,6 +388,31 @@ TEST(SerializeLiftoffModuleFails) {
   CHECK(!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
 }
 
+TEST(SerializeLiftoffCode) {
+  if (!v8_flags.liftoff) return;
+  FlagScope<bool> serialize_liftoff(&v8_flags.wasm_serialize_liftoff_code,
+                                    true);
+  // Make sure that the executed function stays in Liftoff.
+  FlagScope<bool> no_tier_up(&v8_flags.wasm_tier_up, false);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    // The exported function was executed before serialization, so its Liftoff
+    // code should be deserialized instead of being compiled again.
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = module_object->native_module()->GetCode(2);
+    CHECK_NOT_NULL(code);
+    CHECK(code->is_liftoff());
+  }
+  test.CollectGarbage();
+  {
+    HandleScope scope(CcTest::i_isolate());
+    test.DeserializeAndRun();
+  }
+}
+
 TEST(SerializeTieringBudget) {
   WasmSerializationTest test;
 
@@ -434,6 +459,35 @@ TEST(SerializeTieringBudget) {
   }
 }
 
+TEST(ProfileRoundTrip) {
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    v8::Local<v8::WasmModuleObject> v8_module_object =
+        v8::Utils::ToLocal(Cast<JSObject>(module_object))
+            .As<v8::WasmModuleObject>();
+    v8::CompiledWasmModule compiled_module =
+        v8_module_object->GetCompiledModule();
+
+    v8::OwnedBuffer profile = compiled_module.GetProfile();
+    CHECK_LT(0, profile.size);
+    CHECK(compiled_module.ApplyProfile({profile.buffer.get(), profile.size}));
+
+    // Truncated profiles are rejected.
+    CHECK(!compiled_module.ApplyProfile(
+        {profile.buffer.get(), profile.size - 1}));
+
+    // Profiles for other wire bytes or V8 versions are rejected.
+    std::unique_ptr<uint8_t[]> modified(new uint8_t[profile.size]);
+    memcpy(modified.get(), profile.buffer.get(), profile.size);
+    modified[0] ^= 1;
+    CHECK(!compiled_module.ApplyProfile({modified.get(), profile.size}));
+  }
+  test.CollectGarbage();
+}
+
 TEST(DeserializeTieringBudgetPartlyMissing) {
   WasmSerializationTest test;
   {
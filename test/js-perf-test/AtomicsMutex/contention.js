@@ -0,0 +1,91 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the throughput of Atomics.Mutex under contention by several
+// workers, with critical sections of a few hundred nanoseconds, which are the
+// ones that spinning should handle without putting threads to sleep. Run with
+// --js-atomics-mutex-handoff or --no-js-atomics-mutex-adaptive-spinning to
+// compare the locking strategies.
+
+const kWorkers = 4;
+const kIterationsPerWorker = 1000;
+
+new BenchmarkSuite('Uncontended', [1000], [
+  new Benchmark('Uncontended', false, false, 0, Uncontended, SetupUncontended,
+                TearDown),
+]);
+
+new BenchmarkSuite('ShortCriticalSection', [1000], [
+  new Benchmark('ShortCriticalSection', false, false, 0, RunWorkers,
+                SetupWorkers.bind(null, 1), TearDown),
+]);
+
+new BenchmarkSuite('LongCriticalSection', [1000], [
+  new Benchmark('LongCriticalSection', false, false, 0, RunWorkers,
+                SetupWorkers.bind(null, 100), TearDown),
+]);
+
+const workerScript = `
+  onmessage = function({data: msg}) {
+    const {mutex, box, iterations, work} = msg;
+    for (let i = 0; i < iterations; i++) {
+      Atomics.Mutex.lock(mutex, function() {
+        for (let j = 0; j < work; j++) box.counter++;
+      });
+    }
+    postMessage('done');
+  };
+  postMessage('started');`;
+
+let Box;
+let mutex;
+let box;
+let workers;
+let message;
+
+function Setup() {
+  if (Box === undefined) Box = new SharedStructType(['counter']);
+  mutex = new Atomics.Mutex();
+  box = new Box();
+  box.counter = 0;
+}
+
+function SetupUncontended() {
+  Setup();
+  workers = [];
+}
+
+function SetupWorkers(work) {
+  Setup();
+  workers = [];
+  for (let i = 0; i < kWorkers; i++) {
+    workers.push(new Worker(workerScript, {type: 'string'}));
+  }
+  for (const worker of workers) {
+    if (worker.getMessage() !== 'started') throw new Error('Worker failed');
+  }
+  message = {mutex, box, iterations: kIterationsPerWorker, work};
+}
+
+function Uncontended() {
+  for (let i = 0; i < kIterationsPerWorker; i++) {
+    Atomics.Mutex.lock(mutex, function() {
+      box.counter++;
+    });
+  }
+}
+
+function RunWorkers() {
+  for (const worker of workers) worker.postMessage(message);
+  for (const worker of workers) {
+    if (worker.getMessage() !== 'done') throw new Error('Worker failed');
+  }
+}
+
+function TearDown() {
+  for (const worker of workers) worker.terminate();
+  workers = undefined;
+  mutex = undefined;
+  box = undefined;
+}
@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run,
+                LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("TemplateLiteral", [1000], [
+  new Benchmark("TemplateLiteral", false, true, iterations, Run,
+                TemplateLiteralSetup)
+]);
+
+new BenchmarkSuite("TwoByteComment", [1000], [
+  new Benchmark("TwoByteComment", false, true, iterations, Run,
+                TwoByteCommentSetup)
+]);
+
+function LongIdentifiersSetup() {
+  code = "var someRatherLongIdentifier_$0123456789 = 1;\n".repeat(600);
+  %FlattenString(code);
+}
+
+function TemplateLiteralSetup() {
+  code = "`" + " This is a template literal... ".repeat(600) + "`";
+  %FlattenString(code);
+}
+
+function TwoByteCommentSetup() {
+  // The two-byte character makes the whole script a two-byte string.
+  code = "/* ☃" + " This is a comment... ".repeat(600) + "*/";
+  %FlattenString(code);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --concurrent-sparkplug
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-adaptive
+// Flags: --baseline-batch-compilation-min-threshold=100
+// Flags: --allow-natives-syntax --no-always-turbofan
+// Flags: --invocation-count-for-feedback-allocation=4
+
+// Batches are compiled and installed asynchronously, so this only checks that
+// functions keep computing the right results while batches of various sizes
+// get compiled and installed.
+(function() {
+  const kFunctionCount = 200;
+  const functions = [];
+  for (let i = 0; i < kFunctionCount; ++i) {
+    functions.push(new Function('a', 'b',
+        `return (a + b + ${i}) * 42 / a % b;`));
+  }
+  for (let round = 0; round < 20; ++round) {
+    for (let i = 0; i < kFunctionCount; ++i) {
+      %NeverOptimizeFunction(functions[i]);
+      assertEquals((round + 1 + 4711 + i) * 42 / (round + 1) % 4711,
+                   functions[i](round + 1, 4711));
+    }
+  }
+})();
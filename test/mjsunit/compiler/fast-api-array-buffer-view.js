@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises FastApiArrayBufferView arguments to fast API calls,
+// which accept typed arrays of any elements kind without copying them.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// --always-turbofan is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+d8.file.execute('test/mjsunit/compiler/fast-api-helpers.js');
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function sum_bytes(view) {
+  return fast_c_api.sum_bytes(view);
+}
+
+%PrepareFunctionForOptimization(sum_bytes);
+assertEquals(6, sum_bytes(new Uint8Array([1, 2, 3])));
+%OptimizeFunctionOnNextCall(sum_bytes);
+
+// Typed arrays of every elements kind take the fast path, and their bytes
+// are seen in place.
+fast_c_api.reset_counts();
+assertEquals(6, sum_bytes(new Uint8Array([1, 2, 3])));
+assertEquals(0, sum_bytes(new Uint8Array(0)));
+assertEquals(0xFF * 4, sum_bytes(new Int32Array([-1])));
+assertEquals(1 + 2, sum_bytes(new Uint16Array([0x0201])));
+assertEquals(0x3F + 0x80, sum_bytes(new Float32Array([1])));
+assertEquals(0xFF * 8, sum_bytes(new BigInt64Array([-1n])));
+const buffer = new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8]).buffer;
+assertEquals(3 + 4 + 5, sum_bytes(new Uint8Array(buffer, 2, 3)));
+assertEquals(5 + 6 + 7 + 8, sum_bytes(new Uint16Array(buffer, 4)));
+assertOptimized(sum_bytes);
+assertEquals(8, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Views whose length may change, views on shared buffers, and anything that
+// isn't a typed array fall back to the slow path.
+fast_c_api.reset_counts();
+const rab = new ArrayBuffer(4, {maxByteLength: 8});
+new Uint8Array(rab).set([1, 2, 3, 4]);
+assertEquals(10, sum_bytes(new Uint8Array(rab)));
+assertEquals(3 + 4, sum_bytes(new Uint8Array(rab, 2, 2)));
+const sab = new SharedArrayBuffer(2);
+new Uint8Array(sab).set([5, 6]);
+assertEquals(11, sum_bytes(new Uint8Array(sab)));
+assertEquals(0, sum_bytes(new DataView(new ArrayBuffer(2))));
+assertOptimized(sum_bytes);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(4, fast_c_api.slow_call_count());
+
+// Detached buffers fall back to the slow path too.
+fast_c_api.reset_counts();
+const detached = new Uint8Array([1, 2]);
+%ArrayBufferDetach(detached.buffer);
+assertEquals(0, sum_bytes(detached));
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
+
+assertThrows(() => sum_bytes({}));
+assertThrows(() => sum_bytes(1));
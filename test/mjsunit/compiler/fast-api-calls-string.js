@@ -83,3 +83,10 @@ assertSlowCall({});
 assertSlowCall(new Uint8Array(1));
 assertEquals(0, fast_c_api.fast_call_count());
 assertEquals(3, fast_c_api.slow_call_count());
+
+// Look through thin strings.
+fast_c_api.reset_counts();
+assertFastCall(%ConstructThinString('Hello, thin world!'));
+assertOptimized(copy_string);
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
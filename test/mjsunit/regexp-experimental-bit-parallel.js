@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+// Flags: --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-bit-parallel
+// Flags: --no-experimental-regexp-engine-lazy-dfa
+
+// Subjects of at least 64 characters are first scanned by the bit-parallel
+// prefilter, which must never rule out a subject that the regexp matches.
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+const padding = "x".repeat(100);
+const twoBytePadding = "ሴ".repeat(100);
+
+// Plain patterns, with and without a match.
+Test(/asdf/, padding + "asdf", ["asdf"], 0);
+Test(/asdf/, padding + "asdg", null, 0);
+Test(/asdf/, twoBytePadding + "asdf", ["asdf"], 0);
+Test(/asdf/, twoBytePadding + "asdg", null, 0);
+Test(/䌡y/, twoBytePadding + "䌡y", ["䌡y"], 0);
+Test(/䌡y/, twoBytePadding + "䌡z", null, 0);
+
+// Disjunctions and character classes.
+Test(/abc|[0-9]{3}/, padding + "12a", null, 0);
+Test(/abc|[0-9]{3}/, padding + "123", ["123"], 0);
+Test(/[^x]/, padding, null, 0);
+Test(/[^x]/, padding + "y", ["y"], 0);
+Test(/[က- ]/, twoBytePadding, null, 0);
+Test(/[က- ]/, twoBytePadding + "ᔀ", ["ᔀ"], 0);
+
+// Quantifiers and captures.
+Test(/(a+)(b*)c/, padding + "aab", null, 0);
+Test(/(a+)(b*)c/, padding + "aabbc", ["aabbc", "aa", "bb"], 0);
+Test(/(?:ab)*c/, padding + "ababc", ["ababc"], 0);
+Test(/(?:ab)+c/, padding + "abac", null, 0);
+
+// Patterns that can match the empty string always match.
+Test(/y*/, padding, [""], 0);
+Test(/(?:y|)/, padding, [""], 0);
+
+// Assertions are ignored by the prefilter, but not by the interpreter.
+Test(/^x/, padding, ["x"], 0);
+Test(/^y/, padding + "y", null, 0);
+Test(/y$/, padding + "y", ["y"], 0);
+Test(/y$/, padding + "yx", null, 0);
+Test(/\by/, padding + " y", ["y"], 0);
+Test(/\by/, padding + "y", null, 0);
+
+// Sticky and global regexps start at lastIndex.
+var sticky = /x+y/y;
+sticky.lastIndex = 10;
+Test(sticky, padding + "y", [padding.substring(10) + "y"], 101);
+sticky.lastIndex = 10;
+Test(sticky, padding + "z", null, 0);
+var global = /ab/g;
+global.lastIndex = 102;
+Test(global, padding + "abab", ["ab"], 104);
+Test(global, padding + "abab", null, 0);
+
+// Patterns with more states than the prefilter supports.
+var long = new RegExp("a" + ".".repeat(70) + "b");
+Test(long, "a" + padding + "b", null, 0);
+Test(long, padding + "a" + padding.substring(30) + "b",
+     ["a" + padding.substring(30) + "b"], 0);
+Test(/a.{16}.{14}b/, "a" + "x".repeat(30) + "b" + padding,
+     ["a" + "x".repeat(30) + "b"], 0);
+
+// The cached tables are dropped on GC and rebuilt on the next exec.
+var cached = /abc|[0-9]{3}/;
+Test(cached, padding + "12a", null, 0);
+gc();
+Test(cached, padding + "12a", null, 0);
+Test(cached, padding + "123", ["123"], 0);
@@ -0,0 +1,81 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+// Flags: --no-experimental-regexp-engine-bit-parallel
+
+// On subjects of at least 64 characters, the lazy DFA finds where the first
+// match starts before the interpreter runs.  The matches and captures must be
+// the same as without it.
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+    assertEquals(expectedResult.index, result.index);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+function Match(index, ...groups) {
+  var result = groups;
+  result.index = index;
+  return result;
+}
+
+const padding = "x".repeat(100);
+const twoBytePadding = "ሴ".repeat(100);
+
+// Plain patterns, with and without a match.
+Test(/asdf/, padding + "asdf", Match(100, "asdf"), 0);
+Test(/asdf/, padding + "asdg", null, 0);
+Test(/asdf/, twoBytePadding + "asdf" + padding, Match(100, "asdf"), 0);
+Test(/asdf/, twoBytePadding + "asdg", null, 0);
+
+// The match starts at the leftmost position, even if a later match ends
+// earlier.
+Test(/ab+c|b/, padding + "abbbbc", Match(100, "abbbbc"), 0);
+Test(/x*y/, padding + "y", Match(0, padding + "y"), 0);
+Test(/[xy]*z/, padding + "yyz", Match(0, padding + "yyz"), 0);
+
+// Priorities decide where the match ends.
+Test(/abc|..|[a-c]{10,}/, "abcccccccccccccc" + padding, Match(0, "abc"), 0);
+Test(/(?:abc|[a-c]{10,})d|q/, padding + "ab" + "c".repeat(12) + "d",
+     Match(100, "ab" + "c".repeat(12) + "d"), 0);
+Test(/a(b*?)c?/, padding + "abbbc", Match(100, "a", ""), 0);
+Test(/a(b*)c?/, padding + "abbbc", Match(100, "abbbc", "bbb"), 0);
+
+// Captures are computed by the interpreter.
+Test(/(a+)(b*)c/, padding + "aab", null, 0);
+Test(/(a+)(b*)c/, padding + "aaaabbc", Match(100, "aaaabbc", "aaaa", "bb"), 0);
+Test(/(?:(a)|(b))+/, padding + "abab", Match(100, "abab", undefined, "b"), 0);
+
+// Empty quantifier iterations.
+Test(/(?:a*)*b/, padding + "aab", Match(100, "aab"), 0);
+Test(/(?:a|())*b/, padding + "aab", Match(100, "aab", undefined), 0);
+Test(/y*/, padding, Match(0, ""), 0);
+
+// Sticky and global regexps.
+var sticky = /x+y/y;
+sticky.lastIndex = 10;
+Test(sticky, padding + "y", Match(10, padding.substring(10) + "y"), 101);
+sticky.lastIndex = 10;
+Test(sticky, padding + "z", null, 0);
+var global = /a(b)?/g;
+global.lastIndex = 5;
+Test(global, padding + "aab" + padding, Match(100, "a", undefined), 101);
+Test(global, padding + "aab" + padding, Match(101, "ab", "b"), 103);
+assertEquals(["a", "a", "a"], (padding + "aaa").match(/a/g));
+assertEquals(padding + "--b",
+             (padding + "aab").replace(/a(b)?/g, (m, b) => "-" + (b || "")));
+
+// Patterns with many states.
+var long = new RegExp("a" + ".".repeat(70) + "b");
+Test(long, "a" + padding + "b", null, 0);
+Test(long, padding + "a" + padding.substring(30) + "b",
+     Match(100, "a" + padding.substring(30) + "b"), 0);
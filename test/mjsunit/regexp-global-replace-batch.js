@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replaces on long subjects find batches of matches per call into the
+// regexp code, and replacements without substitution patterns are written
+// directly into the result.  Cover batch boundaries, captures, zero-length
+// matches and mixed encodings.
+
+function NaiveReplace(subject, re, replacement) {
+  let result = "";
+  let last = 0;
+  re.lastIndex = 0;
+  let match;
+  while ((match = re.exec(subject)) !== null) {
+    result += subject.substring(last, match.index) + replacement;
+    last = match.index + match[0].length;
+    if (match[0].length == 0) {
+      const wide = re.unicode && subject.codePointAt(last) > 0xFFFF;
+      re.lastIndex = last + (wide ? 2 : 1);
+    }
+  }
+  return result + subject.substring(last);
+}
+
+function Test(subject, re, replacement) {
+  const expected = NaiveReplace(subject, re, replacement);
+  assertEquals(expected, subject.replace(re, replacement));
+  assertEquals(expected, subject.replaceAll(re, replacement));
+}
+
+const kSubject = "<b>bold</b> & <i>x</i> ".repeat(2000);
+
+Test(kSubject, /<[^>]*>/g, "");
+Test(kSubject, /<[^>]*>/g, "_");
+Test(kSubject, /<([^>]*)>/g, "[tag]");
+Test(kSubject, /&/g, "&amp;");
+Test(kSubject, /[<>]/g, "☃");
+Test(kSubject, /x*/g, "-");
+Test(kSubject, /(b)(o)(l)(d)/g, "B");
+Test(kSubject, /nothing/g, "y");
+Test("☃" + kSubject, /<\/?b>/g, "*");
+Test(kSubject.replace(/b/g, "\u{1F600}"), /(?:)/gu, ".");
+
+// The last match info reflects the last match.
+"a1b22c333".repeat(1000).replace(/(\d+)/g, "#");
+assertEquals("333", RegExp.$1);
+assertEquals("333", RegExp.lastMatch);
+
+// Substitution patterns still work.
+assertEquals("[b][/b]", "<b></b>".replace(/<(\/?b)>/g, "[$1]"));
+assertEquals("[b]bold[/b] ".repeat(2000),
+             "<b>bold</b> ".repeat(2000).replace(/<(\/?b)>/g, "[$1]"));
+
+// Replacing everything yields the empty string.
+assertEquals("", "ab".repeat(5000).replace(/ab/g, ""));
+assertEquals("", "ab".repeat(5000).replace(/a(b)/g, ""));
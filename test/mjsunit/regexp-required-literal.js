@@ -0,0 +1,96 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-required-literal-prefilter --js-regexp-modifiers
+
+// On subjects of at least 64 characters, irregexp searches for a literal that
+// every match contains before it runs, and starts matching where the first
+// match can start.  The results must be the same as without the search.
+
+const kPadding = "x".repeat(100);
+const kLongPadding = "a.b_c ".repeat(50);
+
+function Match(index, ...groups) {
+  var result = groups;
+  result.index = index;
+  return result;
+}
+
+function Test(regexp, subject, expectedResult, expectedLastIndex = 0) {
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+    assertEquals(expectedResult.index, result.index);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+// The literal is at a variable offset from the start of the match.
+Test(/\w+@example\.com/, kPadding, null);
+Test(/\w+@example\.com/, kLongPadding + " joe@example.com",
+     Match(301, "joe@example.com"));
+Test(/\w+@example\.com/, kPadding + "@example.com",
+     Match(0, kPadding + "@example.com"));
+Test(/\w+@example\.com/, "@example.com " + kPadding, null);
+
+// The literal is at a fixed offset from the start of the match.
+Test(/\d\d-abc(\d)/, kPadding + "12-abc3", Match(100, "12-abc3", "3"));
+Test(/\d\d-abc(\d)/, kPadding + "1-abc3 12-abc", null);
+Test(/\d\d-abc(\d)/, kPadding + "1-abc3 12-abc4",
+     Match(107, "12-abc4", "4"));
+Test(/.(foo|bar)baz/, kPadding + "xbarbaz", Match(100, "xbarbaz", "bar"));
+
+// Global regexps search from the last index.
+{
+  const re = /ab\d/g;
+  const subject = kPadding + "ab1" + kPadding + "ab2" + kPadding;
+  Test(re, subject, Match(100, "ab1"), 103);
+  Test(re, subject, Match(203, "ab2"), 206);
+  Test(re, subject, null, 0);
+  assertEquals(["ab1", "ab2"], subject.match(re));
+  assertEquals(kPadding + "X" + kPadding + "X" + kPadding,
+               subject.replace(re, "X"));
+  assertEquals([100, 203], [...subject.matchAll(re)].map(m => m.index));
+}
+
+// Sticky regexps only match at the last index.
+{
+  const re = /x+abc/y;
+  const subject = kPadding + "abc";
+  Test(re, subject, Match(0, subject), 103);
+  re.lastIndex = 0;
+  Test(re, "y" + subject, null, 0);
+  re.lastIndex = 1;
+  Test(re, "y" + subject, Match(1, subject), 104);
+}
+
+// Assertions and lookarounds see the characters before the start position.
+Test(/(?<=x)abc/, kPadding + "abc", Match(100, "abc"));
+Test(/(?<!x)abc/, kPadding + "abc", null);
+Test(/(?<!x)abc/, kPadding + "abc yabc", Match(105, "abc"));
+Test(/\babc\b/, kPadding + "abc", null);
+Test(/\babc\b/, kPadding + " abc", Match(101, "abc"));
+Test(/ab\bcd/, kPadding + "abcd", null);
+Test(/^.*abc/, kPadding + "abc", Match(0, kPadding + "abc"));
+Test(/^abc/m, kPadding + "\nabc", Match(101, "abc"));
+
+// Back-references and quantifiers.
+Test(/(a)\1bc/, kPadding + "aabc", Match(100, "aabc", "a"));
+Test(/(?:ab){2}c/, kPadding + "ababc", Match(100, "ababc"));
+Test(/(?:ab)+c/, kPadding + "abababc", Match(100, "abababc"));
+Test(/(?:ab)*cd/, kPadding + "cd", Match(100, "cd"));
+
+// Case-insensitive matching doesn't require the literal as written.
+Test(/hello/i, kPadding + "HeLLo", Match(100, "HeLLo"));
+Test(/(?i:hello) world/, kPadding + "HeLLo world",
+     Match(100, "HeLLo world"));
+
+// Unicode regexps and two-byte subjects.
+Test(/.\u{1F600}ab/u, kPadding + "\u{1F601}\u{1F600}ab",
+     Match(100, "\u{1F601}\u{1F600}ab"));
+Test(/.ab/u, kPadding + "\u{1F601}ab", Match(100, "\u{1F601}ab"));
+Test(/x☃y/, kPadding + "☃x☃y", Match(101, "x☃y"));
+Test(/x☃y/, kPadding + "☃", null);
@@ -0,0 +1,7 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-struct --allow-natives-syntax --js-atomics-mutex-handoff
+
+d8.file.execute('test/mjsunit/shared-memory/mutex-workers.js');
@@ -0,0 +1,86 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Huge ropes are searched without flattening them. Compare the results with
+// searches in flat copies of the same strings.
+
+function BuildRope(pieces) {
+  let rope = '';
+  for (const piece of pieces) rope += piece;
+  return rope;
+}
+
+function Pieces(count, piece_for_index) {
+  const pieces = [];
+  for (let i = 0; i < count; i++) pieces.push(piece_for_index(i));
+  return pieces;
+}
+
+function CheckIndexOf(pieces, patterns) {
+  const flat = %FlattenString(BuildRope(pieces));
+  for (const pattern of patterns) {
+    assertEquals(flat.indexOf(pattern), BuildRope(pieces).indexOf(pattern),
+                 pattern);
+    assertEquals(flat.includes(pattern), BuildRope(pieces).includes(pattern),
+                 pattern);
+  }
+}
+
+(function TestOneByteRope() {
+  const pieces = Pieces(20000, i => 'ab' + (i % 97) + 'c');
+  CheckIndexOf(pieces, [
+    // Found within the first segments.
+    'a', 'c', '96c',
+    // Spanning two or more segments.
+    'cab', 'c1ab', '96cab0cab1cab2',
+    // Not found, or extending past the end.
+    'xyz', 'ab97c', 'ab' + (19999 % 97) + 'cx',
+  ]);
+})();
+
+(function TestTiniestSegments() {
+  const pieces = Pieces(70000, i => String.fromCharCode(97 + i % 3));
+  CheckIndexOf(pieces, ['abc', 'cab', 'aa', 'abcabcabcabcabcabcabcabcx']);
+})();
+
+(function TestTwoByteRope() {
+  const pieces = Pieces(20000, i => i % 7 == 0 ? '☃xy' : 'xyz' + i);
+  CheckIndexOf(pieces, [
+    '☃', 'z1☃', '☃xyxyz', 'xyz6☃xyxyz8', 'xyz19999',
+    '☄', 'a',
+  ]);
+})();
+
+(function TestMatchAtTheEnd() {
+  const pieces = Pieces(20000, i => 'abcd');
+  pieces.push('needle');
+  CheckIndexOf(pieces, ['dneedle', 'needle', 'e', 'needles']);
+})();
+
+(function TestLongPattern() {
+  // Patterns that are too long for searching segments are found after
+  // flattening the rope.
+  const pieces = Pieces(20000, i => 'abc' + i);
+  const pattern = BuildRope(pieces.slice(1000, 1200));
+  CheckIndexOf(pieces, [pattern, pattern + 'x']);
+})();
+
+(function TestStartIndex() {
+  const pieces = Pieces(20000, i => 'abc');
+  const length = 3 * pieces.length;
+  assertEquals(2, BuildRope(pieces).indexOf('cab'));
+  assertEquals(5, BuildRope(pieces).indexOf('cab', 3));
+  assertEquals(-1, BuildRope(pieces).indexOf('cab', length - 2));
+})();
+
+(function TestHashRope() {
+  // Ropes hash to the same value as their flat contents.
+  const pieces = Pieces(500, i => 'key' + i);
+  const set = new Set([BuildRope(pieces)]);
+  assertTrue(set.has(%FlattenString(BuildRope(pieces))));
+  const map = new Map([[%FlattenString(BuildRope(pieces)), 1]]);
+  assertEquals(1, map.get(BuildRope(pieces)));
+})();
@@ -0,0 +1,178 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-memory64 --no-liftoff
+// Flags: --wasm-enforce-bounds-checks
+// Flags: --turboshaft-wasm --turboshaft-wasm-bounds-check-elimination
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function FillMemory(memory) {
+  let view = new Uint32Array(memory.buffer);
+  for (let i = 0; i < view.length; ++i) view[i] = i;
+}
+
+(function TestLoopInductionVariable() {
+  print(arguments.callee.name);
+  for (let memory64 of [false, true]) {
+    let builder = new WasmModuleBuilder();
+    if (memory64) {
+      builder.addMemory64(1, 1);
+    } else {
+      builder.addMemory(1, 1);
+    }
+    builder.exportMemoryAs('memory');
+    let index_type = memory64 ? kWasmI64 : kWasmI32;
+    let index_const = memory64 ? wasmI64Const : wasmI32Const;
+    let add = memory64 ? kExprI64Add : kExprI32Add;
+    let lt_u = memory64 ? kExprI64LtU : kExprI32LtU;
+
+    // Sums up the first {kBytes / 4} words of the memory. The loop bound is a
+    // constant, so the bounds checks can be removed.
+    const kBytes = 1024;
+    builder.addFunction('sum', kSig_i_v)
+        .addLocals(index_type, 1)
+        .addLocals(kWasmI32, 1)
+        .addBody([
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 1,
+            kExprLocalGet, 0,
+            kExprI32LoadMem, 2, 0,
+            kExprI32Add,
+            kExprLocalSet, 1,
+            kExprLocalGet, 0,
+            ...index_const(4),
+            add,
+            kExprLocalTee, 0,
+            ...index_const(kBytes),
+            lt_u,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 1,
+        ])
+        .exportFunc();
+
+    // Same loop with a dynamic bound, which needs to keep the bounds checks.
+    builder.addFunction('sum_dynamic', makeSig([index_type], [kWasmI32]))
+        .addLocals(index_type, 1)
+        .addLocals(kWasmI32, 1)
+        .addBody([
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 2,
+            kExprLocalGet, 1,
+            kExprI32LoadMem, 2, 0,
+            kExprI32Add,
+            kExprLocalSet, 2,
+            kExprLocalGet, 1,
+            ...index_const(4),
+            add,
+            kExprLocalTee, 1,
+            kExprLocalGet, 0,
+            lt_u,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 2,
+        ])
+        .exportFunc();
+
+    let instance = builder.instantiate();
+    FillMemory(instance.exports.memory);
+    const kWords = kBytes / 4;
+    const expected = kWords * (kWords - 1) / 2;
+    assertEquals(expected, instance.exports.sum());
+    let bound = memory64 ? BigInt(kBytes) : kBytes;
+    assertEquals(expected, instance.exports.sum_dynamic(bound));
+    let oob = memory64 ? BigInt(kPageSize + 4) : kPageSize + 4;
+    assertTraps(kTrapMemOutOfBounds, () => instance.exports.sum_dynamic(oob));
+  }
+})();
+
+(function TestAdjacentChecks() {
+  print(arguments.callee.name);
+  for (let memory64 of [false, true]) {
+    let builder = new WasmModuleBuilder();
+    if (memory64) {
+      builder.addMemory64(1, 1);
+    } else {
+      builder.addMemory(1, 1);
+    }
+    builder.exportMemoryAs('memory');
+    let index_type = memory64 ? kWasmI64 : kWasmI32;
+
+    // Loads from {p}, {p + 4} and {p + 8}; the checks are merged into one.
+    builder.addFunction('load3', makeSig([index_type], [kWasmI32]))
+        .addBody([
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 0,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 4,
+          kExprI32Add,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 8,
+          kExprI32Add,
+        ])
+        .exportFunc();
+
+    // A store between the loads must not be skipped if the second load traps.
+    builder.addFunction('load_store_load', makeSig([index_type], [kWasmI32]))
+        .addBody([
+          kExprLocalGet, 0,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 0,
+          kExprI32Const, 1,
+          kExprI32Add,
+          kExprI32StoreMem, 2, 0,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 4,
+        ])
+        .exportFunc();
+
+    // The first check covers the largest end offset. Widening it for the
+    // second check must not lose its own end offset, since the third check is
+    // removed because of it.
+    builder.addFunction('wide_narrow', makeSig([index_type], [kWasmI32]))
+        .addBody([
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 12,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 4,
+          kExprI32Add,
+          kExprLocalGet, 0,
+          kExprI32LoadMem, 2, 8,
+          kExprI32Add,
+        ])
+        .exportFunc();
+
+    let instance = builder.instantiate();
+    let memory = instance.exports.memory;
+    FillMemory(memory);
+    let index = x => memory64 ? BigInt(x) : x;
+
+    assertEquals(4 + 2 + 3, instance.exports.wide_narrow(index(4)));
+    assertEquals(
+        3 * (kPageSize / 4) - 6,
+        instance.exports.wide_narrow(index(kPageSize - 16)));
+    assertTraps(
+        kTrapMemOutOfBounds,
+        () => instance.exports.wide_narrow(index(kPageSize - 12)));
+    assertTraps(
+        kTrapMemOutOfBounds,
+        () => instance.exports.wide_narrow(index(kPageSize - 8)));
+
+    assertEquals(1 + 2 + 3, instance.exports.load3(index(4)));
+    assertEquals(
+        3 * (kPageSize / 4) - 6, instance.exports.load3(index(kPageSize - 12)));
+    assertTraps(
+        kTrapMemOutOfBounds, () => instance.exports.load3(index(kPageSize - 8)));
+    assertTraps(
+        kTrapMemOutOfBounds, () => instance.exports.load3(index(kPageSize)));
+
+    let view = new Uint32Array(memory.buffer);
+    const kLast = kPageSize / 4 - 1;
+    assertTraps(
+        kTrapMemOutOfBounds,
+        () => instance.exports.load_store_load(index(kLast * 4)));
+    assertEquals(kLast + 1, view[kLast]);
+  }
+})();
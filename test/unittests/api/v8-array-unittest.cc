@@ -148,5 +148,50 @@ TEST_F(ArrayTest, IterateEarlyTermination) {
   CHECK(array->Iterate(context(), break_callback, nullptr).IsJust());
 }
 
+TEST_F(ArrayTest, GetElements) {
+  HandleScope scope(isolate());
+  Local<Value> values[4];
+  auto check = [&](const char* source, uint32_t start,
+                   std::initializer_list<const char*> expected) {
+    Local<Array> array = RunJS(source).As<Array>();
+    Maybe<uint32_t> count = array->GetElements(context(), start, values);
+    ASSERT_TRUE(count.IsJust()) << source;
+    ASSERT_EQ(expected.size(), count.FromJust()) << source;
+    uint32_t i = 0;
+    for (const char* element : expected) {
+      Local<Value> value = RunJS(element);
+      EXPECT_TRUE(value->SameValue(values[i])) << source << "[" << i << "]";
+      EXPECT_TRUE(
+          array->Get(context(), start + i).ToLocalChecked()->SameValue(value));
+      i++;
+    }
+  };
+  // Fast elements of every kind.
+  check("[1, 2, 3]", 0, {"1", "2", "3"});
+  check("[1, 2, 3]", 1, {"2", "3"});
+  check("[1, 2, 3]", 3, {});
+  check("[1, 2, 3]", 7, {});
+  check("[1, 2, 3, 4, 5, 6]", 1, {"2", "3", "4", "5"});
+  check("[1.5, 2.5]", 0, {"1.5", "2.5"});
+  check("[1.5, , 2.5]", 0, {"1.5", "undefined", "2.5"});
+  check("['a', {}, , 'b']", 2, {"undefined", "'b'"});
+  check("Object.freeze(['a', 'b'])", 0, {"'a'", "'b'"});
+  // Elements that need a lookup.
+  check("var a = [1, , 3]; a.__proto__ = [7, 8, 9]; a", 0, {"1", "8", "3"});
+  check("var a = []; a[100000] = 1; a", 99999, {"undefined", "1"});
+  check(
+      "var a = [1, 2];"
+      "Object.defineProperty(a, 1, {get() { return 5; }}); a",
+      0, {"1", "5"});
+
+  Local<Array> throwing =
+      RunJS("var a = [1, 2]; Object.defineProperty(a, 1, {get() { throw 1; }});"
+            "a")
+          .As<Array>();
+  TryCatch try_catch(isolate());
+  EXPECT_TRUE(throwing->GetElements(context(), 0, values).IsNothing());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
 }  // namespace
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include "include/v8-local-handle.h"
 #include "include/v8-primitive.h"
 #include "include/v8-template.h"
+#include "src/api/api-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -37,6 +38,112 @@ TEST_F(ObjectTest, SetAccessorWhenUnconfigurablePropAlreadyDefined) {
   ASSERT_FALSE(try_catch.HasCaught());
 }
 
+TEST_F(ObjectTest, GetMultiple) {
+  HandleScope scope(isolate());
+  Local<Object> object =
+      RunJS(
+          "var proto = {inherited: 'p'};"
+          "var o = {__proto__: proto, a: 1, b: 1.5, cc: 'c',"
+          "         get d() { return this.a + 1; }, f() {}, 0: 'zero'};"
+          "o")
+          .As<Object>();
+  const char* kNames[] = {"a", "b", "cc", "d", "f", "inherited", "0", "none"};
+  Local<Name> keys[std::size(kNames)];
+  for (size_t i = 0; i < std::size(kNames); ++i) {
+    keys[i] = String::NewFromUtf8(isolate(), kNames[i],
+                                  NewStringType::kInternalized)
+                  .ToLocalChecked();
+  }
+  // A key that isn't internalized.
+  keys[2] = String::NewFromUtf8Literal(isolate(), "cc");
+  Local<Value> values[std::size(kNames)];
+
+  auto check = [&](Local<Object> receiver) {
+    ASSERT_TRUE(receiver->GetMultiple(context(), keys, values).IsJust());
+    for (size_t i = 0; i < std::size(kNames); ++i) {
+      Local<Value> expected =
+          receiver->Get(context(), keys[i]).ToLocalChecked();
+      EXPECT_TRUE(expected->SameValue(values[i])) << kNames[i];
+    }
+  };
+  check(object);
+  EXPECT_EQ(2, values[3]->NumberValue(context()).FromJust());
+  EXPECT_TRUE(values[4]->IsFunction());
+  EXPECT_TRUE(values[7]->IsUndefined());
+
+  // Double fields are copied rather than shared with the object.
+  RunJS("o.b = 2.5");
+  EXPECT_EQ(1.5, values[1]->NumberValue(context()).FromJust());
+
+  // Objects in dictionary mode and proxies.
+  check(RunJS("delete o.cc; o").As<Object>());
+  check(RunJS("new Proxy(o, {})").As<Object>());
+
+  // Exceptions from getters are propagated.
+  Local<Object> throwing = RunJS("({get a() { throw 1; }})").As<Object>();
+  TryCatch try_catch(isolate());
+  EXPECT_TRUE(throwing->GetMultiple(context(), keys, values).IsNothing());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
+TEST_F(ObjectTest, TemplateInstancesHaveInObjectFields) {
+  HandleScope scope(isolate());
+  constexpr int kProperties = 10;
+  Local<FunctionTemplate> function_template = FunctionTemplate::New(isolate());
+  Local<ObjectTemplate> instance_template =
+      function_template->InstanceTemplate();
+  instance_template->SetInternalFieldCount(1);
+  Local<ObjectTemplate> object_template = ObjectTemplate::New(isolate());
+  for (int i = 0; i < kProperties; ++i) {
+    std::string name = "p" + std::to_string(i);
+    Local<String> key = String::NewFromUtf8(isolate(), name.c_str(),
+                                            NewStringType::kInternalized)
+                            .ToLocalChecked();
+    instance_template->Set(key, Number::New(isolate(), i));
+    object_template->Set(key, Number::New(isolate(), i));
+  }
+
+  auto check = [&](Local<Object> object) {
+    i::DirectHandle<i::JSObject> i_object =
+        i::Cast<i::JSObject>(Utils::OpenDirectHandle(*object));
+    EXPECT_TRUE(i_object->HasFastProperties());
+    EXPECT_EQ(0, i_object->property_array()->length());
+    EXPECT_LE(kProperties, i_object->map()->GetInObjectProperties());
+    Local<Array> names =
+        object->GetOwnPropertyNames(context()).ToLocalChecked();
+    ASSERT_EQ(static_cast<uint32_t>(kProperties), names->Length());
+    for (int i = 0; i < kProperties; ++i) {
+      Local<Value> key = names->Get(context(), i).ToLocalChecked();
+      EXPECT_EQ(i, object->Get(context(), key)
+                       .ToLocalChecked()
+                       ->Int32Value(context())
+                       .FromJust());
+    }
+  };
+
+  Local<Function> constructor =
+      function_template->GetFunction(context()).ToLocalChecked();
+  Local<Object> instances[] = {
+      constructor->NewInstance(context()).ToLocalChecked(),
+      constructor->NewInstance(context()).ToLocalChecked(),
+      object_template->NewInstance(context()).ToLocalChecked(),
+      object_template->NewInstance(context()).ToLocalChecked()};
+  for (Local<Object> instance : instances) check(instance);
+  EXPECT_EQ(1, instances[0]->InternalFieldCount());
+
+  // Instances created from the cached one are independent copies.
+  for (int i = 0; i < 4; i += 2) {
+    Local<String> key = String::NewFromUtf8Literal(isolate(), "p0");
+    Local<Value> value = Number::New(isolate(), 42);
+    EXPECT_TRUE(instances[i]->Set(context(), key, value).FromJust());
+    EXPECT_EQ(0, instances[i + 1]
+                     ->Get(context(), key)
+                     .ToLocalChecked()
+                     ->Int32Value(context())
+                     .FromJust());
+  }
+}
+
 using LapContextTest = TestWithIsolate;
 
 TEST_F(LapContextTest, CurrentContextInLazyAccessorOnPrototype) {
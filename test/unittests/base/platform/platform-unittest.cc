@@ -13,6 +13,7 @@
 #include "testing/gtest/include/gtest/gtest.h"
 
 #ifdef V8_TARGET_OS_LINUX
+#include <sched.h>
 #include <sys/sysmacros.h>
 
 #include "src/base/platform/platform-linux.h"
@@ -76,6 +77,58 @@ TEST(OS, RemapPages) {
   }
 }
 
+TEST(OS, NumaNodes) {
+  const int node_count = OS::GetNumaNodeCount();
+  EXPECT_LE(1, node_count);
+  EXPECT_LE(0, OS::GetCurrentNumaNode());
+  EXPECT_GT(node_count, OS::GetCurrentNumaNode());
+  EXPECT_FALSE(CurrentThreadNumaNodeScope(node_count).is_active());
+  EXPECT_FALSE(CurrentThreadNumaNodeScope(OS::kAnyNumaNode).is_active());
+  if (node_count == 1) {
+    // Without NUMA, nothing is pinned.
+    EXPECT_FALSE(CurrentThreadNumaNodeScope(0).is_active());
+    return;
+  }
+  for (int node = 0; node < node_count; ++node) {
+    CurrentThreadNumaNodeScope scope(node);
+    if (!scope.is_active()) continue;
+    EXPECT_EQ(node, OS::GetCurrentNumaNode());
+    const size_t size = OS::AllocatePageSize();
+    void* memory = OS::Allocate(nullptr, size, size,
+                                OS::MemoryPermission::kReadWrite);
+    ASSERT_TRUE(memory);
+    EXPECT_TRUE(OS::SetNumaNodeForMemory(memory, size, node));
+    memset(memory, 0, size);
+    OS::Free(memory, size);
+  }
+}
+
+#ifdef V8_TARGET_OS_LINUX
+TEST(OS, NumaNodeScopeRestoresAffinity) {
+  if (OS::GetNumaNodeCount() == 1) return;
+  cpu_set_t initial;
+  ASSERT_EQ(0, sched_getaffinity(0, sizeof(initial), &initial));
+  // An affinity set by the embedder, which differs from the one that the
+  // process started with.
+  cpu_set_t embedder;
+  CPU_ZERO(&embedder);
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &initial)) {
+      CPU_SET(cpu, &embedder);
+      break;
+    }
+  }
+  ASSERT_EQ(0, sched_setaffinity(0, sizeof(embedder), &embedder));
+  for (int node = 0; node < OS::GetNumaNodeCount(); ++node) {
+    { CurrentThreadNumaNodeScope scope(node); }
+    cpu_set_t restored;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(restored), &restored));
+    EXPECT_TRUE(CPU_EQUAL(&embedder, &restored));
+  }
+  ASSERT_EQ(0, sched_setaffinity(0, sizeof(initial), &initial));
+}
+#endif  // V8_TARGET_OS_LINUX
+
 #ifdef V8_TARGET_OS_LINUX
 TEST(OS, ParseProcMaps) {
   // Truncated
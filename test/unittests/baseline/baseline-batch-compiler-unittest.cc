@@ -0,0 +1,98 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-batch-compiler.h"
+
+#include "src/flags/flags.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal::baseline {
+
+class AdaptiveBatchSizerTest : public ::testing::Test {
+ public:
+  AdaptiveBatchSizerTest()
+      : threshold_(&v8_flags.baseline_batch_compilation_threshold, 4 * KB),
+        min_threshold_(&v8_flags.baseline_batch_compilation_min_threshold,
+                       1 * KB),
+        max_threshold_(&v8_flags.baseline_batch_compilation_max_threshold,
+                       64 * KB),
+        target_ms_(&v8_flags.baseline_batch_compilation_target_ms, 1.0) {}
+
+  static base::TimeDelta Ms(int ms) {
+    return base::TimeDelta::FromMilliseconds(ms);
+  }
+
+ private:
+  FlagScope<int> threshold_;
+  FlagScope<int> min_threshold_;
+  FlagScope<int> max_threshold_;
+  FlagScope<double> target_ms_;
+};
+
+TEST_F(AdaptiveBatchSizerTest, StartsAtThreshold) {
+  AdaptiveBatchSizer sizer;
+  EXPECT_EQ(4 * KB, sizer.threshold());
+}
+
+TEST_F(AdaptiveBatchSizerTest, InitialThresholdIsClamped) {
+  FlagScope<int> threshold(&v8_flags.baseline_batch_compilation_threshold,
+                           256 * KB);
+  AdaptiveBatchSizer sizer;
+  EXPECT_EQ(64 * KB, sizer.threshold());
+}
+
+TEST_F(AdaptiveBatchSizerTest, GrowsAndShrinksWithThroughput) {
+  AdaptiveBatchSizer sizer;
+  // A batch of 8KB compiled in 1ms allows batches of 8KB.
+  sizer.RecordBatch(8 * KB, Ms(1), Ms(0));
+  EXPECT_EQ(8 * KB, sizer.threshold());
+
+  // Slower batches shrink the threshold, but only gradually.
+  sizer.RecordBatch(1 * KB, Ms(1), Ms(0));
+  int after_one_slow_batch = sizer.threshold();
+  EXPECT_LT(after_one_slow_batch, 8 * KB);
+  EXPECT_GT(after_one_slow_batch, 1 * KB);
+  for (int i = 0; i < 50; ++i) sizer.RecordBatch(1 * KB, Ms(1), Ms(0));
+  EXPECT_LT(sizer.threshold(), after_one_slow_batch);
+  EXPECT_NEAR(1 * KB, sizer.threshold(), 16);
+
+  // Faster batches grow it again.
+  for (int i = 0; i < 50; ++i) sizer.RecordBatch(32 * KB, Ms(1), Ms(0));
+  EXPECT_NEAR(32 * KB, sizer.threshold(), 16);
+}
+
+TEST_F(AdaptiveBatchSizerTest, StaysWithinBounds) {
+  AdaptiveBatchSizer sizer;
+  sizer.RecordBatch(1 * MB, Ms(1), Ms(0));
+  EXPECT_EQ(64 * KB, sizer.threshold());
+  for (int i = 0; i < 50; ++i) sizer.RecordBatch(16, Ms(1), Ms(0));
+  EXPECT_EQ(1 * KB, sizer.threshold());
+}
+
+TEST_F(AdaptiveBatchSizerTest, GrowsWhenInstallIsDelayed) {
+  AdaptiveBatchSizer idle;
+  idle.RecordBatch(4 * KB, Ms(1), Ms(0));
+  EXPECT_EQ(4 * KB, idle.threshold());
+
+  // A main thread that takes twice the target time to install a batch gets
+  // batches twice as large.
+  AdaptiveBatchSizer busy;
+  busy.RecordBatch(4 * KB, Ms(1), Ms(2));
+  EXPECT_EQ(8 * KB, busy.threshold());
+
+  // The growth is limited, however busy the main thread is.
+  AdaptiveBatchSizer very_busy;
+  very_busy.RecordBatch(4 * KB, Ms(1), Ms(100));
+  EXPECT_EQ(16 * KB, very_busy.threshold());
+}
+
+TEST_F(AdaptiveBatchSizerTest, IgnoresEmptyBatches) {
+  AdaptiveBatchSizer sizer;
+  sizer.RecordBatch(8 * KB, Ms(1), Ms(0));
+  sizer.RecordBatch(0, Ms(10), Ms(0));
+  EXPECT_EQ(8 * KB, sizer.threshold());
+}
+
+}  // namespace v8::internal::baseline
@@ -0,0 +1,190 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/loop-unswitching-reducer.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/partial-redundancy-elimination-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LoopUnswitchingReducerTest : public ReducerTest {
+ public:
+  static size_t CountLoops(const Graph& graph) {
+    size_t count = 0;
+    for (const Block& block : graph.blocks()) {
+      if (block.IsLoop()) count++;
+    }
+    return count;
+  }
+};
+
+// The loop branches on a condition computed before the loop, and should thus
+// be duplicated into two branch-free loops.
+TEST_F(LoopUnswitchingReducerTest, UnswitchInvariantBranch) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> flag =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::FromInt(0)));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+
+    WHILE(__ Int32LessThan(index, 1000)) {
+      IF (flag) {
+        sum = __ Word32Add(sum, index);
+      } ELSE {
+        sum = __ Word32Sub(sum, index);
+      }
+      index = __ Word32Add(index, 1);
+    }
+
+    __ Return(__ TagSmi(sum));
+  });
+
+  ASSERT_EQ(CountLoops(test.graph()), 1u);
+  size_t branch_count = test.CountOp(Opcode::kBranch);
+
+  test.Run<LoopUnswitchingReducer, MachineOptimizationReducer,
+           ValueNumberingReducer>();
+
+  ASSERT_EQ(CountLoops(test.graph()), 2u);
+  // The invariant branch is replaced by a single branch before the loops, but
+  // each loop keeps its own exit branch.
+  ASSERT_EQ(test.CountOp(Opcode::kBranch), branch_count + 1);
+}
+
+// The branch depends on a loop phi, so the loop should not be unswitched.
+TEST_F(LoopUnswitchingReducerTest, NoUnswitchVariantBranch) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+
+    WHILE(__ Int32LessThan(index, 1000)) {
+      IF (__ Word32BitwiseAnd(index, 1)) {
+        sum = __ Word32Add(sum, index);
+      } ELSE {
+        sum = __ Word32Sub(sum, index);
+      }
+      index = __ Word32Add(index, 1);
+    }
+
+    __ Return(__ TagSmi(sum));
+  });
+
+  test.Run<LoopUnswitchingReducer, MachineOptimizationReducer,
+           ValueNumberingReducer>();
+
+  ASSERT_EQ(CountLoops(test.graph()), 1u);
+}
+
+// Unswitching the loop would exceed the code size budget.
+TEST_F(LoopUnswitchingReducerTest, NoUnswitchOverBudget) {
+  FlagScope<int> budget(&v8_flags.turboshaft_loop_unswitching_budget, 1);
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> flag =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::FromInt(0)));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+
+    WHILE(__ Int32LessThan(index, 1000)) {
+      IF (flag) {
+        sum = __ Word32Add(sum, index);
+      } ELSE {
+        sum = __ Word32Sub(sum, index);
+      }
+      index = __ Word32Add(index, 1);
+    }
+
+    __ Return(__ TagSmi(sum));
+  });
+
+  test.Run<LoopUnswitchingReducer, MachineOptimizationReducer,
+           ValueNumberingReducer>();
+
+  ASSERT_EQ(CountLoops(test.graph()), 1u);
+}
+
+// Both sides of the diamond compute `a * b`, which should be hoisted above the
+// branch and thus only be computed once.
+TEST_F(LoopUnswitchingReducerTest, HoistCommonOperation) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> a = __ UntagSmi(V<Smi>::Cast(Asm.GetParameter(0)));
+    V<Word32> b = __ UntagSmi(V<Smi>::Cast(Asm.GetParameter(1)));
+
+    ScopedVariable<Word32, AssemblerT> result(&Asm);
+    IF (__ Int32LessThan(a, b)) {
+      result = __ Word32Add(__ Word32Mul(a, b), 1);
+    } ELSE {
+      result = __ Word32Sub(__ Word32Mul(a, b), 1);
+    }
+
+    __ Return(__ TagSmi(result));
+  });
+
+  size_t binop_count = test.CountOp(Opcode::kWordBinop);
+
+  test.Run<PartialRedundancyEliminationReducer, ValueNumberingReducer>();
+
+  // Only one of the two multiplications should remain.
+  ASSERT_EQ(test.CountOp(Opcode::kWordBinop), binop_count - 1);
+}
+
+// The loop contains a diamond with a common operation, and is unswitched, so
+// that the operation is hoisted in both copies of the loop.
+TEST_F(LoopUnswitchingReducerTest, HoistInUnswitchedLoop) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> a = __ UntagSmi(V<Smi>::Cast(Asm.GetParameter(0)));
+    V<Word32> b = __ UntagSmi(V<Smi>::Cast(Asm.GetParameter(1)));
+    V<Word32> flag = __ Int32LessThan(a, b);
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+
+    WHILE(__ Int32LessThan(index, 1000)) {
+      IF (flag) {
+        sum = __ Word32Add(sum, 1);
+      } ELSE {
+        sum = __ Word32Sub(sum, 1);
+      }
+      IF (__ Word32BitwiseAnd(index, 1)) {
+        sum = __ Word32Add(sum, __ Word32Mul(a, index));
+      } ELSE {
+        sum = __ Word32Sub(sum, __ Word32Mul(a, index));
+      }
+      index = __ Word32Add(index, 1);
+    }
+
+    __ Return(__ TagSmi(sum));
+  });
+
+  test.Run<LoopUnswitchingReducer, PartialRedundancyEliminationReducer,
+           MachineOptimizationReducer, ValueNumberingReducer>();
+
+  ASSERT_EQ(CountLoops(test.graph()), 2u);
+  // Each copy of the loop computes `a * index` only once.
+  size_t mul_count = 0;
+  for (const Operation& op : test.graph().AllOperations()) {
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      if (binop->kind == WordBinopOp::Kind::kMul) mul_count++;
+    }
+  }
+  ASSERT_EQ(mul_count, 2u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -361,6 +361,22 @@ TEST_F(GCTracerTest, IncrementalMarkingSpeed) {
                        tracer->IncrementalMarkingSpeedInBytesPerMillisecond()));
 }
 
+TEST_F(GCTracerTest, CompactionPauseSpeed) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  EXPECT_EQ(0, tracer->CompactionPauseSpeedInBytesPerMillisecond());
+  // 1000000 bytes in 100ms.
+  tracer->AddCompactionPauseEvent(base::TimeDelta::FromMilliseconds(100),
+                                  1000000);
+  EXPECT_EQ(1000000 / 100, tracer->CompactionPauseSpeedInBytesPerMillisecond());
+  // 1000000 bytes in 300ms.
+  tracer->AddCompactionPauseEvent(base::TimeDelta::FromMilliseconds(300),
+                                  1000000);
+  EXPECT_EQ(2000000 / 400, tracer->CompactionPauseSpeedInBytesPerMillisecond());
+  // The speed of copying alone is tracked separately.
+  EXPECT_EQ(0, tracer->CompactionSpeedInBytesPerMillisecond());
+}
+
 TEST_F(GCTracerTest, MutatorUtilization) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
@@ -13,6 +13,7 @@
 #include "src/handles/handles.h"
 
 #include "src/heap/heap-controller.h"
+#include "src/heap/predictive-heap-controller.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -108,5 +109,101 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+namespace {
+
+PredictiveHeapController::Config TestConfig(size_t memory_limit = 0) {
+  return {0.5, memory_limit, 1 * MB, V8HeapTrait::kMaxGrowingFactor};
+}
+
+base::TimeTicks AfterMs(int ms) {
+  return base::TimeTicks() + base::TimeDelta::FromMilliseconds(ms);
+}
+
+}  // namespace
+
+TEST_F(MemoryControllerTest, PredictiveControllerNeedsMeasurements) {
+  PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+  EXPECT_FALSE(controller.Update(100 * MB, 0, 1000, AfterMs(0)));
+  EXPECT_FALSE(controller.Update(100 * MB, 1000, 0, AfterMs(100)));
+  EXPECT_TRUE(controller.Update(100 * MB, 1000, 1000, AfterMs(200)));
+}
+
+TEST_F(MemoryControllerTest, PredictiveControllerBounds) {
+  using Bound = PredictiveHeapController::Bound;
+  // Half of the time in mark-compacts means as much time marking the live
+  // bytes as allocating the headroom.
+  {
+    PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+    auto decision = controller.Update(100 * MB, 1000, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kGCCpuShare, decision->bound);
+    EXPECT_EQ(size_t{200} * MB, decision->limit);
+    EXPECT_EQ(size_t{100} * MB, decision->predicted_live_bytes);
+  }
+  {
+    PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+    auto decision = controller.Update(100 * MB, 1000000, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kMaxGrowingFactor, decision->bound);
+    EXPECT_EQ(static_cast<size_t>(100 * MB * V8HeapTrait::kMaxGrowingFactor),
+              decision->limit);
+  }
+  {
+    PredictiveHeapController controller(i_isolate()->heap(),
+                                        TestConfig(150 * MB));
+    auto decision = controller.Update(100 * MB, 1000, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kMemoryLimit, decision->bound);
+    EXPECT_EQ(size_t{150} * MB, decision->limit);
+  }
+  {
+    PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+    auto decision = controller.Update(100 * MB, 1, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kMinimumHeadroom, decision->bound);
+    EXPECT_EQ(size_t{101} * MB, decision->limit);
+  }
+  {
+    // The minimum headroom wins over a memory limit that can't be met.
+    PredictiveHeapController controller(i_isolate()->heap(),
+                                        TestConfig(100 * MB + 512 * KB));
+    auto decision = controller.Update(100 * MB, 1, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kMinimumHeadroom, decision->bound);
+    EXPECT_EQ(size_t{101} * MB, decision->limit);
+  }
+  {
+    // The heap's maximum old generation size wins over everything.
+    Heap* heap = i_isolate()->heap();
+    const size_t max_size = heap->max_old_generation_size();
+    PredictiveHeapController controller(heap, TestConfig(2 * max_size));
+    auto decision = controller.Update(max_size / 2, 1000000, 1000, AfterMs(0));
+    EXPECT_EQ(Bound::kHeapSize, decision->bound);
+    EXPECT_EQ(max_size, decision->limit);
+  }
+}
+
+TEST_F(MemoryControllerTest, PredictiveControllerSmoothsBursts) {
+  PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+  std::optional<PredictiveHeapController::Decision> decision;
+  for (int i = 0; i < 10; ++i) {
+    decision = controller.Update(100 * MB, 100, 1000, AfterMs(i * 100));
+  }
+  const size_t steady_limit = decision->limit;
+  decision = controller.Update(100 * MB, 500, 1000, AfterMs(1000));
+  EXPECT_LT(steady_limit, decision->limit);
+  PredictiveHeapController fresh(i_isolate()->heap(), TestConfig());
+  EXPECT_GT(fresh.Update(100 * MB, 500, 1000, AfterMs(0))->limit,
+            decision->limit);
+}
+
+TEST_F(MemoryControllerTest, PredictiveControllerAnticipatesLiveGrowth) {
+  PredictiveHeapController controller(i_isolate()->heap(), TestConfig());
+  std::optional<PredictiveHeapController::Decision> decision;
+  for (int i = 0; i < 10; ++i) {
+    decision = controller.Update((100 + i) * MB, 100, 1000, AfterMs(i * 100));
+  }
+  EXPECT_LT(0, decision->live_bytes_trend);
+  EXPECT_LT(decision->live_bytes, decision->predicted_live_bytes);
+  PredictiveHeapController flat(i_isolate()->heap(), TestConfig());
+  EXPECT_GT(decision->limit,
+            flat.Update(109 * MB, 100, 1000, AfterMs(0))->limit);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -23,6 +23,7 @@
 #include "src/heap/trusted-range.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -464,6 +465,57 @@ TEST_F(HeapTest, RememberedSet_InsertOnPromotingObjectToOld) {
   }
 }
 
+TEST_F(HeapTest, CompactionPauseBudgetLimitsEvacuationCandidates) {
+  if (!v8_flags.compact || v8_flags.stress_compaction ||
+      v8_flags.stress_compaction_random || v8_flags.compact_on_every_full_gc ||
+      v8_flags.manual_evacuation_candidates_selection ||
+      !v8_flags.compact_with_stack || v8_flags.stress_incremental_marking) {
+    return;
+  }
+  v8_flags.stress_concurrent_allocation = false;  // For SealCurrentObjects.
+  ManualGCScope manual_gc_scope(isolate());
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap());
+  FlagScope<double> budget(&v8_flags.compaction_pause_budget_ms, 1000);
+  SealCurrentObjects();
+  heap()->tracer()->ResetForTesting();
+
+  // Fills fresh old space pages with arrays, of which only every 32nd one
+  // survives, and returns whether a full GC moved any of the survivors.
+  auto full_gc_moves_fragmented_pages = [this]() {
+    HandleScope scope(isolate());
+    std::vector<Handle<FixedArray>> survivors;
+    for (int i = 0; i < 256; ++i) {
+      Handle<FixedArray> array =
+          isolate()->factory()->NewFixedArray(1024, AllocationType::kOld);
+      if (i % 32 == 0) survivors.push_back(array);
+    }
+    // Sweep the garbage, so that the next GC sees fragmented pages.
+    InvokeMajorGC();
+    heap()->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+    std::vector<Address> addresses;
+    for (DirectHandle<FixedArray> array : survivors) {
+      addresses.push_back(array->address());
+    }
+    InvokeMajorGC();
+    heap()->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+    for (size_t i = 0; i < survivors.size(); ++i) {
+      if (survivors[i]->address() != addresses[i]) return true;
+    }
+    return false;
+  };
+
+  // Without a measured speed, the budget doesn't apply. The GC measures it.
+  EXPECT_EQ(0, heap()->tracer()->CompactionPauseSpeedInBytesPerMillisecond());
+  EXPECT_TRUE(full_gc_moves_fragmented_pages());
+  EXPECT_LT(0, heap()->tracer()->CompactionPauseSpeedInBytesPerMillisecond());
+
+  // A budget that is too small for any page leaves all of them in place.
+  v8_flags.compaction_pause_budget_ms = 1e-9;
+  EXPECT_FALSE(full_gc_moves_fragmented_pages());
+}
+
 TEST_F(HeapTest, Regress978156) {
   if (!v8_flags.incremental_marking) return;
   if (v8_flags.single_generation) return;
@@ -4,6 +4,7 @@
 
 #include <optional>
 
+#include "include/v8-statistics.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/heap/parked-scope-inl.h"
@@ -110,12 +111,9 @@ class BlockingLockingThread final : public LockingThread {
   bool should_wait_;
 };
 
-}  // namespace
-
-TEST_F(JSAtomicsMutexTest, Contention) {
+void TestContention(Isolate* i_main_isolate) {
   constexpr int kThreads = 32;
 
-  Isolate* i_main_isolate = i_isolate();
   Handle<JSAtomicsMutex> contended_mutex =
       i_main_isolate->factory()->NewJSAtomicsMutex();
   ParkingSemaphore sema_ready(0);
@@ -144,10 +142,9 @@ TEST_F(JSAtomicsMutexTest, Contention) {
   EXPECT_FALSE(contended_mutex->IsHeld());
 }
 
-TEST_F(JSAtomicsMutexTest, Timeout) {
+void TestTimeout(Isolate* i_main_isolate) {
   constexpr int kThreads = 32;
 
-  Isolate* i_main_isolate = i_isolate();
   Handle<JSAtomicsMutex> contended_mutex =
       i_main_isolate->factory()->NewJSAtomicsMutex();
   ParkingSemaphore sema_ready(0);
@@ -189,6 +186,147 @@ TEST_F(JSAtomicsMutexTest, Timeout) {
   blocking_thread->ParkedJoin(local_isolate);
 }
 
+class TimingOutLockingThread final : public ParkingThread {
+ public:
+  TimingOutLockingThread(Handle<JSAtomicsMutex> mutex,
+                         ParkingSemaphore* sema_ready,
+                         ParkingSemaphore* sema_execute_complete)
+      : ParkingThread(Options("TimingOutLockingThread")),
+        mutex_(mutex),
+        sema_ready_(sema_ready),
+        sema_execute_complete_(sema_execute_complete) {}
+
+  void Run() override {
+    IsolateWithContextWrapper isolate_wrapper;
+    Isolate* isolate = isolate_wrapper.isolate();
+    sema_ready_->Signal();
+    HandleScope scope(isolate);
+    locked_ = JSAtomicsMutex::Lock(isolate, mutex_,
+                                   base::TimeDelta::FromMilliseconds(1));
+    EXPECT_FALSE(mutex_->IsCurrentThreadOwner());
+    sema_execute_complete_->Signal();
+  }
+
+  bool locked() const { return locked_; }
+
+ private:
+  Handle<JSAtomicsMutex> mutex_;
+  ParkingSemaphore* sema_ready_;
+  ParkingSemaphore* sema_execute_complete_;
+  bool locked_ = true;
+};
+
+ParkingSemaphore* sema_waiter_timed_out;
+ParkingSemaphore* sema_resume_waiter;
+
+// Keeps a waiter that timed out in the waiter queue until the test resumes it.
+void BlockTimedOutWaiter() {
+  sema_waiter_timed_out->Signal();
+  sema_resume_waiter->ParkedWait(
+      Isolate::Current()->main_thread_local_isolate());
+}
+
+}  // namespace
+
+TEST_F(JSAtomicsMutexTest, Contention) { TestContention(i_isolate()); }
+
+TEST_F(JSAtomicsMutexTest, ContentionWithHandoff) {
+  FlagScope<bool> handoff(&v8_flags.js_atomics_mutex_handoff, true);
+  TestContention(i_isolate());
+}
+
+TEST_F(JSAtomicsMutexTest, ContentionWithoutAdaptiveSpinning) {
+  FlagScope<bool> adaptive_spinning(
+      &v8_flags.js_atomics_mutex_adaptive_spinning, false);
+  TestContention(i_isolate());
+}
+
+TEST_F(JSAtomicsMutexTest, Timeout) { TestTimeout(i_isolate()); }
+
+TEST_F(JSAtomicsMutexTest, TimeoutWithHandoff) {
+  FlagScope<bool> handoff(&v8_flags.js_atomics_mutex_handoff, true);
+  TestTimeout(i_isolate());
+}
+
+TEST_F(JSAtomicsMutexTest, HandoffSkipsTimedOutWaiter) {
+  FlagScope<bool> handoff(&v8_flags.js_atomics_mutex_handoff, true);
+  Isolate* i_main_isolate = i_isolate();
+  LocalIsolate* local_isolate = i_main_isolate->main_thread_local_isolate();
+  Handle<JSAtomicsMutex> mutex = i_main_isolate->factory()->NewJSAtomicsMutex();
+  EXPECT_TRUE(JSAtomicsMutex::Lock(i_main_isolate, mutex));
+
+  ParkingSemaphore sema_ready(0);
+  ParkingSemaphore sema_execute_complete(0);
+  ParkingSemaphore sema_timed_out(0);
+  ParkingSemaphore sema_resume(0);
+  sema_waiter_timed_out = &sema_timed_out;
+  sema_resume_waiter = &sema_resume;
+  JSAtomicsMutex::SetTimedOutWaiterHookForTesting(&BlockTimedOutWaiter);
+
+  auto thread = std::make_unique<TimingOutLockingThread>(
+      mutex, &sema_ready, &sema_execute_complete);
+  CHECK(thread->Start());
+  sema_ready.ParkedWait(local_isolate);
+  // The waiter timed out but has not dequeued itself yet.
+  sema_timed_out.ParkedWait(local_isolate);
+  EXPECT_EQ(1, Smi::ToInt(mutex->NumWaitersForTesting(i_main_isolate)));
+
+  AtomicsSynchronizationStatistics before;
+  v8_isolate()->GetAtomicsSynchronizationStatistics(&before);
+  mutex->Unlock(i_main_isolate);
+  AtomicsSynchronizationStatistics after;
+  v8_isolate()->GetAtomicsSynchronizationStatistics(&after);
+
+  // The unlock skipped the waiter instead of handing the mutex to it.
+  EXPECT_FALSE(mutex->IsHeld());
+  EXPECT_EQ(0, Smi::ToInt(mutex->NumWaitersForTesting(i_main_isolate)));
+  EXPECT_EQ(before.handoff_count(), after.handoff_count());
+
+  sema_resume.Signal();
+  sema_execute_complete.ParkedWait(local_isolate);
+  thread->ParkedJoin(local_isolate);
+  JSAtomicsMutex::SetTimedOutWaiterHookForTesting(nullptr);
+  EXPECT_FALSE(thread->locked());
+  EXPECT_FALSE(mutex->IsHeld());
+}
+
+TEST_F(JSAtomicsMutexTest, SynchronizationStatistics) {
+  Isolate* i_main_isolate = i_isolate();
+  LocalIsolate* local_isolate = i_main_isolate->main_thread_local_isolate();
+  Handle<JSAtomicsMutex> mutex = i_main_isolate->factory()->NewJSAtomicsMutex();
+  ParkingSemaphore sema_ready(0);
+  ParkingSemaphore sema_execute_start(0);
+  ParkingSemaphore sema_execute_complete(0);
+  auto blocking_thread = std::make_unique<BlockingLockingThread>(
+      mutex, std::nullopt, &sema_ready, &sema_execute_start,
+      &sema_execute_complete);
+  CHECK(blocking_thread->Start());
+  sema_ready.ParkedWait(local_isolate);
+  sema_execute_start.Signal();
+  sema_execute_complete.ParkedWait(local_isolate);
+
+  AtomicsSynchronizationStatistics before;
+  v8_isolate()->GetAtomicsSynchronizationStatistics(&before);
+  // The mutex is held by the other thread, so this spins, goes to sleep and
+  // times out.
+  EXPECT_FALSE(JSAtomicsMutex::Lock(i_main_isolate, mutex,
+                                    base::TimeDelta::FromMilliseconds(1)));
+  AtomicsSynchronizationStatistics after;
+  v8_isolate()->GetAtomicsSynchronizationStatistics(&after);
+
+  EXPECT_EQ(before.contended_lock_count() + 1, after.contended_lock_count());
+  EXPECT_LT(before.spin_count(), after.spin_count());
+  EXPECT_EQ(before.spin_acquire_count(), after.spin_acquire_count());
+  EXPECT_EQ(before.park_count() + 1, after.park_count());
+  EXPECT_LE(before.park_time_in_us() + 1000, after.park_time_in_us());
+  EXPECT_EQ(before.handoff_count(), after.handoff_count());
+
+  blocking_thread->NotifyCV();
+  sema_execute_complete.ParkedWait(local_isolate);
+  blocking_thread->ParkedJoin(local_isolate);
+  EXPECT_FALSE(mutex->IsHeld());
+}
+
 namespace {
 class WaitOnConditionThread final : public ParkingThread {
  public:
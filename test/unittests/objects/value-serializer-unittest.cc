@@ -2083,6 +2083,169 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+class ValueSerializerTestWithObjectShapes : public ValueSerializerTest {
+ protected:
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetUseObjectShapes(true);
+  }
+};
+
+TEST_F(ValueSerializerTestWithObjectShapes, RoundTripObjectsWithSameShape) {
+  const char* kSource =
+      "(() => {"
+      "  const list = [];"
+      "  for (let i = 0; i < 100; i++) {"
+      "    list.push({id: i, name: 'item' + i, value: i / 2, tags: [i]});"
+      "  }"
+      "  return list;"
+      "})()";
+  Local<Value> value = RoundTripTest(kSource);
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 100");
+  ExpectScriptTrue(
+      "result.every((o, i) => o.id === i && o.name === 'item' + i && "
+      "o.value === i / 2 && o.tags[0] === i)");
+  ExpectScriptTrue(
+      "result.every(o => Object.keys(o).join() === 'id,name,value,tags')");
+
+  // The keys are only written once, so the data is smaller than without
+  // object shapes.
+  std::vector<uint8_t> with_shapes = EncodeTest(kSource);
+  std::vector<uint8_t> without_shapes;
+  {
+    Context::Scope scope(serialization_context());
+    ValueSerializer serializer(isolate());
+    serializer.WriteHeader();
+    ASSERT_TRUE(serializer
+                    .WriteValue(serialization_context(),
+                                EvaluateScriptForInput(kSource))
+                    .FromMaybe(false));
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    without_shapes.assign(buffer.first, buffer.first + buffer.second);
+    free(buffer.first);
+  }
+  EXPECT_LT(with_shapes.size(), without_shapes.size());
+}
+
+TEST_F(ValueSerializerTestWithObjectShapes, RoundTripObjectShapeCycles) {
+  RoundTripTest("(() => { const o = {a: 1}; o.a = o; return [o, {a: o}]; })()");
+  ExpectScriptTrue("result[0].a === result[0]");
+  ExpectScriptTrue("result[1].a === result[0]");
+
+  // Values that don't fit the field representations of the previous object.
+  RoundTripTest("[{x: 1, y: 2}, {x: 'a', y: 1.5}, {x: {}, y: null}]");
+  ExpectScriptTrue("result[0].x === 1 && result[0].y === 2");
+  ExpectScriptTrue("result[1].x === 'a' && result[1].y === 1.5");
+  ExpectScriptTrue("typeof result[2].x === 'object' && result[2].y === null");
+
+  // Objects with non-enumerable or accessor properties are still written
+  // without shapes.
+  RoundTripTest(
+      "[Object.defineProperty({a: 1}, 'b', {value: 2}), "
+      " {a: 1, get b() { return 3; }}]");
+  ExpectScriptTrue("result[0].a === 1 && !result[0].hasOwnProperty('b')");
+  ExpectScriptTrue("result[1].a === 1 && result[1].b === 3");
+}
+
+TEST_F(ValueSerializerTestWithObjectShapes, DecodeInvalidObjectShape) {
+  // Reference to an object shape that wasn't defined.
+  InvalidDecodeTest({0xFF, 0x0F, 0x6A, 0x00, 0x49, 0x02});
+  // Object shape with a key that isn't a string.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x01, 0x49, 0x02, 0x49, 0x02});
+  // Object shape with duplicate keys.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x02, 0x22, 0x01, 0x61, 0x22, 0x01,
+                     0x61, 0x49, 0x02, 0x49, 0x04});
+}
+
+class ValueSerializerTestWithOutOfBandArrayBuffers
+    : public ValueSerializerTest {
+ protected:
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithOutOfBandArrayBuffers* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    bool WriteArrayBufferContents(Isolate* isolate, const void* data,
+                                  size_t byte_length,
+                                  uint32_t* contents_id) override {
+      const uint8_t* bytes = static_cast<const uint8_t*>(data);
+      *contents_id = static_cast<uint32_t>(test_->contents_.size());
+      test_->contents_.emplace_back(bytes, bytes + byte_length);
+      return true;
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandArrayBuffers* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithOutOfBandArrayBuffers* test)
+        : test_(test) {}
+    MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t contents_id) override {
+      if (contents_id >= test_->contents_.size()) return {};
+      const std::vector<uint8_t>& contents = test_->contents_[contents_id];
+      Local<ArrayBuffer> array_buffer =
+          ArrayBuffer::New(isolate, contents.size());
+      if (!contents.empty()) {
+        memcpy(array_buffer->GetBackingStore()->Data(), contents.data(),
+               contents.size());
+      }
+      return array_buffer;
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandArrayBuffers* test_;
+  };
+
+  ValueSerializerTestWithOutOfBandArrayBuffers()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  std::vector<std::vector<uint8_t>> contents_;
+
+ private:
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithOutOfBandArrayBuffers, RoundTripArrayBuffer) {
+  std::vector<uint8_t> data = EncodeTest(
+      "(() => {"
+      "  const buffer = new Uint8Array(1024).fill(7).buffer;"
+      "  return {a: buffer, b: new Uint16Array(buffer, 2, 3), c: buffer};"
+      "})()");
+  // The contents are not part of the serialized data.
+  ASSERT_EQ(1u, contents_.size());
+  EXPECT_EQ(1024u, contents_[0].size());
+  EXPECT_LT(data.size(), 1024u);
+
+  DecodeTest(data);
+  ExpectScriptTrue("result.a instanceof ArrayBuffer");
+  ExpectScriptTrue("result.a.byteLength === 1024");
+  ExpectScriptTrue("new Uint8Array(result.a).every(x => x === 7)");
+  ExpectScriptTrue("result.b instanceof Uint16Array");
+  ExpectScriptTrue("result.b.buffer === result.a");
+  ExpectScriptTrue("result.b.byteOffset === 2 && result.b.length === 3");
+  ExpectScriptTrue("result.c === result.a");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandArrayBuffers,
+       DecodeInvalidContentsId) {
+  InvalidDecodeTest({0xFF, 0x0F, 0x4F, 0x00});
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   FLAG_SCOPE(js_float16array);
   // Check that the right type comes out the other side for every kind of typed
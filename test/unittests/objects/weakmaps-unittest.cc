@@ -381,6 +381,50 @@ TEST_F(WeakMapsTest, WeakMapsWithChainedEntries) {
   CHECK_EQ(1, i_isolate()->heap()->gc_count() - initial_gc_count);
 }
 
+TEST_F(WeakMapsTest, ParallelClearing) {
+  v8_flags.parallel_weak_ref_clearing = true;
+  Isolate* isolate = i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Use more weak maps than fit into a segment of the worklist, so that they
+  // are cleared by several job items.
+  constexpr int kWeakMaps = 1000;
+  DirectHandle<Map> map = factory->NewContextfulMapForCurrentContext(
+      JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  DirectHandle<FixedArray> weakmaps = factory->NewFixedArray(kWeakMaps);
+  DirectHandle<FixedArray> keys = factory->NewFixedArray(kWeakMaps);
+  for (int i = 0; i < kWeakMaps; ++i) {
+    HandleScope inner_scope(isolate);
+    Handle<JSWeakMap> weakmap = factory->NewJSWeakMap();
+    Handle<JSObject> key = factory->NewJSObjectFromMap(map);
+    Handle<Symbol> symbol = factory->NewSymbol();
+    DirectHandle<Smi> smi(Smi::FromInt(i), isolate);
+    int32_t hash = Object::GetOrCreateHash(*key, isolate).value();
+    JSWeakCollection::Set(weakmap, key, smi, hash);
+    JSWeakCollection::Set(weakmap, symbol, smi, symbol->hash());
+    weakmaps->set(i, *weakmap);
+    keys->set(i, *key);
+  }
+
+  {
+    // We need to invoke GC without stack, otherwise some objects may not be
+    // reclaimed because of conservative stack scanning.
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        isolate->heap());
+    InvokeAtomicMajorGC();
+  }
+  // Only the entries with symbol keys are removed.
+  for (int i = 0; i < kWeakMaps; ++i) {
+    Tagged<EphemeronHashTable> table = Cast<EphemeronHashTable>(
+        Cast<JSWeakMap>(weakmaps->get(i))->table());
+    CHECK_EQ(1, table->NumberOfElements());
+    CHECK_EQ(1, table->NumberOfDeletedElements());
+    Handle<Object> key(keys->get(i), isolate);
+    CHECK_EQ(i, Smi::ToInt(table->Lookup(key)));
+  }
+}
+
 }  // namespace test_weakmaps
 }  // namespace internal
 }  // namespace v8
@@ -837,6 +837,143 @@ TEST_F(PreParserTest, TopLevelArrowFunctions) {
   EXPECT_FALSE(IsCompiled("i()"));
 }
 
+namespace {
+
+void CheckSamePreparseData(i::Tagged<i::PreparseData> expected,
+                           i::Tagged<i::PreparseData> actual) {
+  CHECK_EQ(expected->data_length(), actual->data_length());
+  for (int index = 0; index < expected->data_length(); ++index) {
+    CHECK_EQ(expected->get(index), actual->get(index));
+  }
+  CHECK_EQ(expected->children_length(), actual->children_length());
+  for (int index = 0; index < expected->children_length(); ++index) {
+    CheckSamePreparseData(expected->get_child(index),
+                          actual->get_child(index));
+  }
+}
+
+}  // namespace
+
+TEST_F(PreParserTest, ParallelPreparse) {
+  // Top-level function declarations of all kinds, with statements in between
+  // that the pre-scan has to skip over.
+  constexpr char kSource[] = R"(
+    var before = /[{(]/.test("}") ? `${"{"}` : 1 / 2;
+    function simple(a, b) { return a + b; }
+    function withInner(a) {
+      var x = 1;
+      function inner() { x = 2; return a; }
+      return inner;
+    }
+    function* generator() { yield /}/; }
+    async function asyncFunction(a = {b: 1}, ...rest) { await a; }
+    async function* asyncGenerator() { yield `${ {a: 1}.a }`; }
+    // function inLineComment() {
+    /* function inBlockComment() { */
+    var expression = function named() { return { a: 1 }; };
+    if (before) { function inBlock() {} }
+    function usesEval(a) { return eval(a); }
+    function usesArguments() { return arguments.length; }
+    function strict(a) { "use strict"; let b = a; return () => b; }
+    class C extends Object { m() { return super.m; } }
+    function last() { var re = /\//; return "}'" + '{"'; }
+  )";
+  i::Isolate* isolate = i_isolate();
+  i::Factory* factory = isolate->factory();
+  i::FlagScope<int> min_function_size(
+      &i::v8_flags.parallel_preparse_min_function_size, 0);
+  i::FlagScope<bool> join(&i::v8_flags.parallel_preparse_join_for_testing,
+                          true);
+
+  for (const char* directive : {"", "'use strict';"}) {
+    // Only external sources can be read by the worker threads, so the others
+    // are always preparsed on the main thread.
+    for (bool external : {true, false}) {
+      i::HandleScope scope(isolate);
+      std::string source = std::string(directive) + kSource;
+      test::ScriptResource resource(source.c_str(), source.length(), 0);
+      i::Handle<i::String> source_string =
+          external
+              ? factory->NewExternalStringFromOneByte(&resource)
+                    .ToHandleChecked()
+              : factory->NewStringFromAsciiChecked(source.c_str());
+
+      // Parse the script without and with preparsing in parallel.
+      i::ReusableUnoptimizedCompileState reusable_state(isolate);
+      i::DirectHandle<i::Script> sequential_script =
+          factory->NewScript(source_string);
+      i::UnoptimizedCompileFlags flags =
+          i::UnoptimizedCompileFlags::ForScriptCompile(isolate,
+                                                       *sequential_script);
+      i::UnoptimizedCompileState sequential_state;
+      i::ParseInfo sequential_info(isolate, flags, &sequential_state,
+                                   &reusable_state);
+      {
+        i::FlagScope<bool> parallel_preparse(&i::v8_flags.parallel_preparse,
+                                             false);
+        CHECK(i::parsing::ParseProgram(&sequential_info, sequential_script,
+                                       isolate,
+                                       i::parsing::ReportStatisticsMode::kNo));
+      }
+      i::DirectHandle<i::Script> parallel_script =
+          factory->NewScript(source_string);
+      i::UnoptimizedCompileState parallel_state;
+      i::ParseInfo parallel_info(isolate, flags, &parallel_state,
+                                 &reusable_state);
+      {
+        i::FlagScope<bool> parallel_preparse(&i::v8_flags.parallel_preparse,
+                                             true);
+        CHECK(i::parsing::ParseProgram(&parallel_info, parallel_script, isolate,
+                                       i::parsing::ReportStatisticsMode::kNo));
+      }
+
+      CHECK_EQ(0, sequential_info.parallel_preparsed_function_count());
+      if (external) {
+        CHECK_LT(0, parallel_info.parallel_preparsed_function_count());
+      } else {
+        CHECK_EQ(0, parallel_info.parallel_preparsed_function_count());
+      }
+
+      // Skipping the functions has to give the same results either way.
+      auto* expected = sequential_info.scope()->declarations();
+      auto* actual = parallel_info.scope()->declarations();
+      CHECK_EQ(expected->LengthForTest(), actual->LengthForTest());
+      for (int index = 0; index < expected->LengthForTest(); ++index) {
+        i::Declaration* expected_decl = expected->AtForTest(index);
+        i::Declaration* actual_decl = actual->AtForTest(index);
+        CHECK_EQ(expected_decl->IsFunctionDeclaration(),
+                 actual_decl->IsFunctionDeclaration());
+        if (!expected_decl->IsFunctionDeclaration()) continue;
+        i::FunctionLiteral* expected_fun =
+            expected_decl->AsFunctionDeclaration()->fun();
+        i::FunctionLiteral* actual_fun =
+            actual_decl->AsFunctionDeclaration()->fun();
+        CHECK_EQ(expected_fun->start_position(), actual_fun->start_position());
+        CHECK_EQ(expected_fun->end_position(), actual_fun->end_position());
+        CHECK_EQ(expected_fun->parameter_count(),
+                 actual_fun->parameter_count());
+        CHECK_EQ(expected_fun->function_length(),
+                 actual_fun->function_length());
+        CHECK_EQ(expected_fun->language_mode(), actual_fun->language_mode());
+        i::ProducedPreparseData* expected_data =
+            expected_fun->produced_preparse_data();
+        i::ProducedPreparseData* actual_data =
+            actual_fun->produced_preparse_data();
+        CHECK_EQ(expected_data == nullptr, actual_data == nullptr);
+        if (expected_data == nullptr) continue;
+        CheckSamePreparseData(*expected_data->Serialize(isolate),
+                              *actual_data->Serialize(isolate));
+      }
+
+      // This avoids the GC from trying to free a stack allocated resource.
+      if (IsExternalString(*source_string)) {
+        i::Cast<i::ExternalOneByteString>(source_string)
+            ->SetResource(isolate, nullptr);
+      }
+    }
+  }
+}
+
 TEST_F(PreParserTest, ProducingAndConsumingByteData) {
   i::Isolate* isolate = i_isolate();
   i::HandleScope scope(isolate);
@@ -7,7 +7,13 @@
 
 #include "src/parsing/scanner.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "src/ast/ast-value-factory.h"
 #include "src/handles/handles-inl.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/scanner-character-streams.h"
@@ -32,8 +38,11 @@ class ScannerTest : public TestWithIsolate {
     Scanner* get() const { return scanner.get(); }
   };
   ScannerTestHelper make_scanner(const char* src) {
+    return make_scanner(ScannerStream::ForTesting(src));
+  }
+  ScannerTestHelper make_scanner(std::unique_ptr<Utf16CharacterStream> stream) {
     ScannerTestHelper helper;
-    helper.stream = ScannerStream::ForTesting(src);
+    helper.stream = std::move(stream);
     helper.scanner = std::unique_ptr<Scanner>(new Scanner(
         helper.stream.get(),
         UnoptimizedCompileFlags::ForTest(
@@ -155,5 +164,84 @@ TEST_F(ScannerTest, PeekAheadAheadAwaitExpression) {
   CHECK_TOK(tokens[3], scanner->PeekAheadAhead());
 }
 
+TEST_F(ScannerTest, LongRuns) {
+  // Runs of characters that are long enough for the vectorized fast paths,
+  // with the characters that end them at all positions within a vector.
+  const char src[] =
+      "/* a multi-line comment with * and / inside */ /* and one that spans\n"
+      "    several lines * / */\n"
+      "// a single line comment which is longer than a vector\n"
+      "\t\t        anIdentifierThatIsLongerThanAnyKeyword instanceof "
+      "instanceofx $_0123456789\n"
+      "'a string literal with \\'escapes\\' and \"quotes\" and more'\n"
+      "`a template literal with $ signs, {braces} and \\`escapes\\` \r\n`";
+  const Token::Value tokens[] = {Token::kIdentifier, Token::kInstanceOf,
+                                 Token::kIdentifier, Token::kIdentifier,
+                                 Token::kString,     Token::kTemplateTail,
+                                 Token::kEos};
+
+  auto check_literals = [&](Scanner* scanner) {
+    for (size_t i = 0; i < arraysize(tokens); i++) {
+      CHECK_TOK(tokens[i], scanner->Next());
+      if (i == 0) {
+        CHECK(scanner->CurrentLiteralEquals(
+            "anIdentifierThatIsLongerThanAnyKeyword"));
+      } else if (i == 2) {
+        CHECK(scanner->CurrentLiteralEquals("instanceofx"));
+      } else if (i == 3) {
+        CHECK(scanner->CurrentLiteralEquals("$_0123456789"));
+      } else if (i == 4) {
+        CHECK(scanner->CurrentLiteralEquals(
+            "a string literal with 'escapes' and \"quotes\" and more"));
+      } else if (i == 5) {
+        CHECK(scanner->CurrentLiteralEquals(
+            "a template literal with $ signs, {braces} and `escapes` \n"));
+      }
+    }
+  };
+
+  // The one-byte stream, with the runs starting at different offsets within
+  // the vectors.
+  for (size_t start = 0; start < 8; start++) {
+    std::string padded = std::string(start, ' ') + src;
+    auto scanner = make_scanner(padded.c_str());
+    check_literals(scanner.get());
+  }
+
+  // The same source as a two-byte stream.
+  std::vector<uint16_t> two_byte(src, src + strlen(src));
+  auto scanner = make_scanner(
+      ScannerStream::ForTesting(two_byte.data(), two_byte.size()));
+  check_literals(scanner.get());
+
+  // Non-ASCII characters in the middle of the runs.
+  std::vector<uint16_t> non_ascii(two_byte);
+  std::replace(non_ascii.begin(), non_ascii.end(), static_cast<uint16_t>('g'),
+               static_cast<uint16_t>(0xE9));
+  scanner = make_scanner(
+      ScannerStream::ForTesting(non_ascii.data(), non_ascii.size()));
+  for (Token::Value token : tokens) CHECK_TOK(token, scanner->Next());
+
+  // A template literal whose runs cross the end of the buffer of the one-byte
+  // stream, which is refilled in the middle of them.
+  std::string half;
+  for (int i = 0; i < 40; i++) half += "0123456789abcdef";
+  std::string raw = half + "\\u0041" + half;
+  std::string cooked = half + "A" + half;
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  for (size_t start = 0; start < 8; start++) {
+    std::string source = std::string(start, ' ') + "`" + raw + "`";
+    auto template_scanner = make_scanner(source.c_str());
+    CHECK_TOK(Token::kTemplateTail, template_scanner->Next());
+    CHECK_EQ(0, strcmp(cooked.c_str(),
+                       template_scanner->CurrentLiteralAsCString(&zone)));
+    AstValueFactory ast_value_factory(
+        &zone, i_isolate()->ast_string_constants(), HashSeed(i_isolate()));
+    CHECK(template_scanner->CurrentRawSymbol(&ast_value_factory)
+              ->IsOneByteEqualTo(raw.c_str()));
+    CHECK_TOK(Token::kEos, template_scanner->Next());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-segment-pool.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,83 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReusesSegments) {
+  ZoneSegmentPool* pool = ZoneSegmentPool::Get();
+  AccountingAllocator allocator;
+  void* first;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first = zone.Allocate<ZoneTestTag>(16);
+  }
+  uint64_t hit_count = pool->hit_count();
+  uint64_t thread_cache_hit_count = pool->thread_cache_hit_count();
+  void* second;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    second = zone.Allocate<ZoneTestTag>(16);
+  }
+  // The segment of the first zone is the most recently returned one.
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(hit_count + 1, pool->hit_count());
+  EXPECT_EQ(thread_cache_hit_count + 1, pool->thread_cache_hit_count());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
+TEST_F(ZoneTest, SegmentPoolSkipsLargeSegments) {
+  ZoneSegmentPool* pool = ZoneSegmentPool::Get();
+  AccountingAllocator allocator;
+  uint64_t hit_count = pool->hit_count();
+  uint64_t miss_count = pool->miss_count();
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(2 * ZoneSegmentPool::kMaxPooledSize);
+  }
+  EXPECT_EQ(hit_count, pool->hit_count());
+  EXPECT_EQ(miss_count, pool->miss_count());
+}
+
+TEST_F(ZoneTest, SegmentPoolKeepsSegmentSizes) {
+  ZoneSegmentPool* pool = ZoneSegmentPool::Get();
+  AccountingAllocator allocator;
+  uint64_t hit_count = pool->hit_count();
+  uint64_t miss_count = pool->miss_count();
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    // The first segment has the minimum size and the second one, whose size
+    // depends on the allocation, is not pooled.
+    zone.Allocate<ZoneTestTag>(16);
+    zone.Allocate<ZoneTestTag>(ZoneSegmentPool::kMinPooledSize);
+    EXPECT_EQ(zone.segment_bytes_allocated(),
+              allocator.GetCurrentMemoryUsage());
+    EXPECT_LT(allocator.GetCurrentMemoryUsage(),
+              ZoneSegmentPool::kMinPooledSize +
+                  ZoneSegmentPool::kMaxPooledSize);
+  }
+  EXPECT_EQ(hit_count + miss_count + 1,
+            pool->hit_count() + pool->miss_count());
+}
+
+TEST_F(ZoneTest, SegmentPoolReleaseMemory) {
+  ZoneSegmentPool* pool = ZoneSegmentPool::Get();
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    // Allocate more than the thread cache holds, so that some segments end up
+    // in the shared lists. All but the first of these allocations take a new
+    // segment of kMaxPooledSize.
+    for (size_t i = 0; i < 4; ++i) {
+      zone.Allocate<ZoneTestTag>(ZoneSegmentPool::kMaxPooledSize / 2);
+    }
+  }
+  pool->ReleaseMemory();
+  EXPECT_EQ(0u, pool->shared_size());
+  uint64_t miss_count = pool->miss_count();
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(16);
+  }
+  EXPECT_EQ(miss_count + 1, pool->miss_count());
+}
+
 }  // namespace internal
 }  // namespace v8